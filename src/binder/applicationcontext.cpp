@@ -243,6 +243,31 @@ namespace BINDER_SPACE
         
         sTrustedPlatformAssemblies.Normalize();
 
+        {
+            // Size both tables for the number of entries up front so that the hundreds of TPA
+            // entries typical of an app don't cause repeated rehashing while they are added.
+            COUNT_T cTpaEntries = 1;
+            for (SString::Iterator i = sTrustedPlatformAssemblies.Begin(); i != sTrustedPlatformAssemblies.End(); ++i)
+            {
+                if (*i == PATH_SEPARATOR_CHAR_W)
+                {
+                    cTpaEntries++;
+                }
+            }
+
+            COUNT_T cTableSize = cTpaEntries * 4 / 3 + 1;
+            m_pTrustedPlatformAssemblyMap->Reallocate(cTableSize);
+            m_pFileNameHash->Reallocate(cTableSize);
+        }
+
+        // GCC complains if we create SStrings inline as part of a function call
+        SString sNiDll(W(".ni.dll"));
+        SString sNiExe(W(".ni.exe"));
+        SString sNiWinmd(W(".ni.winmd"));
+        SString sDll(W(".dll"));
+        SString sExe(W(".exe"));
+        SString sWinmd(W(".winmd"));
+
         for (SString::Iterator i = sTrustedPlatformAssemblies.Begin(); i != sTrustedPlatformAssemblies.End(); )
         {
             SString fileName;
@@ -282,14 +307,6 @@ namespace BINDER_SPACE
             SString simpleName;
             bool isNativeImage = false;
 
-            // GCC complains if we create SStrings inline as part of a function call
-            SString sNiDll(W(".ni.dll"));
-            SString sNiExe(W(".ni.exe"));
-            SString sNiWinmd(W(".ni.winmd"));
-            SString sDll(W(".dll"));
-            SString sExe(W(".exe"));
-            SString sWinmd(W(".winmd"));
-            
             if (fileName.EndsWithCaseInsensitive(sNiDll) ||
                 fileName.EndsWithCaseInsensitive(sNiExe))
             {
@@ -387,6 +387,23 @@ ArrayNative::AssignArrayEnum ArrayNative::CanAssignArrayType(const BASEARRAYREF
 }
 
 
+// Returns true if ObjIsInstanceOf may give different answers for two objects with this MethodTable.
+static BOOL IsCastResultPerInstance(MethodTable *pMT)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef FEATURE_COMINTEROP
+    // RCWs answer interface casts with a QueryInterface on the underlying COM object
+    if (pMT->IsComObjectType())
+        return TRUE;
+#endif // FEATURE_COMINTEROP
+#ifdef FEATURE_ICASTABLE
+    if (pMT->IsICastable())
+        return TRUE;
+#endif // FEATURE_ICASTABLE
+    return FALSE;
+}
+
 // Casts and assigns each element of src array to the dest array type.
 void ArrayNative::CastCheckEachElement(const BASEARRAYREF pSrcUnsafe, const unsigned int srcIndex, BASEARRAYREF pDestUnsafe, unsigned int destIndex, const unsigned int len)
 {
@@ -416,6 +433,11 @@ void ArrayNative::CastCheckEachElement(const BASEARRAYREF pSrcUnsafe, const unsi
     gc.pDest = pDestUnsafe;
     gc.pSrc = pSrcUnsafe;
 
+    // Arrays being copied usually hold long runs of elements of the same exact type, so remember the
+    // last MethodTable that passed the cast check and only do the full check when the type changes.
+    // Types whose castability is decided per instance (COM objects, ICastable) are never remembered.
+    MethodTable *pLastCheckedMT = NULL;
+
     GCPROTECT_BEGIN(gc);
     
     for(unsigned int i=srcIndex; i<srcIndex + len; ++i)
@@ -424,8 +446,17 @@ void ArrayNative::CastCheckEachElement(const BASEARRAYREF pSrcUnsafe, const unsi
 
         // Now that we have grabbed obj, we are no longer subject to races from another
         // mutator thread.
-        if (gc.obj != NULL && !ObjIsInstanceOf(OBJECTREFToObject(gc.obj), destTH))
-            COMPlusThrow(kInvalidCastException, W("InvalidCast_DownCastArrayElement"));
+        if (gc.obj != NULL && gc.obj->GetMethodTable() != pLastCheckedMT)
+        {
+            if (!ObjIsInstanceOf(OBJECTREFToObject(gc.obj), destTH))
+                COMPlusThrow(kInvalidCastException, W("InvalidCast_DownCastArrayElement"));
+
+            MethodTable *pMT = gc.obj->GetMethodTable();
+            if (!IsCastResultPerInstance(pMT))
+            {
+                pLastCheckedMT = pMT;
+            }
+        }
 
         OBJECTREF * destData = (OBJECTREF*)(gc.pDest->GetDataPtr()) + i - srcIndex + destIndex;
         SetObjectReference(destData, gc.obj);
@@ -36,7 +36,9 @@ private:
     LONG m_ref;                         // reference count
     int m_fd;
     CrashInfo& m_crashInfo;
-    BYTE m_tempBuffer[0x4000];
+    // Memory regions are copied through this buffer one pread/write pair at a time, so it
+    // is sized to keep the syscall count down on large heaps. DumpWriter is heap allocated.
+    BYTE m_tempBuffer[0x100000];
 
 public:
     DumpWriter(CrashInfo& crashInfo);
@@ -6367,13 +6367,22 @@ HeapData::~HeapData()
 }
 
 LinearReadCache::LinearReadCache()
-    : mCurrPageStart(0), mPageSize(0), mCurrPageSize(0), mPage(0)
+    : mCurrPageStart(0), mPageSize(0), mCurrPageSize(0), mSystemPageSize(0), mPage(0)
 {
     SYSTEM_INFO si;
 	GetSystemInfo(&si);
 
-    mPageSize = si.dwPageSize;
+    // Heap walks read object headers front to back, so read several pages ahead
+    // per request to the data target. If the larger buffer can't be had, fall
+    // back to caching a single page.
+    mPageSize = si.dwPageSize * LinearReadCachePages;
     mPage = new (nothrow) BYTE[mPageSize];
+    if (mPage == NULL)
+    {
+        mPageSize = si.dwPageSize;
+        mPage = new (nothrow) BYTE[mPageSize];
+    }
+    mSystemPageSize = si.dwPageSize;
 }
 
 LinearReadCache::~LinearReadCache()
@@ -6384,9 +6393,15 @@ LinearReadCache::~LinearReadCache()
 
 bool LinearReadCache::MoveToPage(CORDB_ADDRESS addr)
 {
-    mCurrPageStart = addr - (addr % mPageSize);
+    mCurrPageStart = addr - (addr % mSystemPageSize);
     HRESULT hr = g_dacImpl->m_pTarget->ReadVirtual(mCurrPageStart, mPage, mPageSize, &mCurrPageSize);
 
+    // The read-ahead may run off the end of the readable memory (the end of a segment,
+    // or a region missing from a dump). Data targets differ in whether they return a
+    // partial read or fail, so retry with just the page containing addr.
+    if ((hr != S_OK) && (mPageSize > mSystemPageSize))
+        hr = g_dacImpl->m_pTarget->ReadVirtual(mCurrPageStart, mPage, mSystemPageSize, &mCurrPageSize);
+
     if (hr != S_OK)
     {
         mCurrPageStart = 0;
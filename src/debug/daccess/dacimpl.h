@@ -1611,8 +1611,9 @@ struct HeapData
 };
 
 /* This cache is used to read data from the target process if the reads are known
- * to be sequential.  This will object will read one page of memory out of the
- * process at a time, aligned to the page boundary, to 
+ * to be sequential.  This will object will read a window of several pages of memory
+ * out of the process at a time, aligned to the page boundary, to cut down on the
+ * number of requests made to the data target.
  */
 class LinearReadCache
 {
@@ -1694,8 +1695,11 @@ private:
     }
 
 private:
+    // Number of target pages read at a time.
+    static const ULONG32 LinearReadCachePages = 16;
+
     CORDB_ADDRESS mCurrPageStart;
-    ULONG32 mPageSize, mCurrPageSize;
+    ULONG32 mPageSize, mCurrPageSize, mSystemPageSize;
     BYTE *mPage;
 };
 
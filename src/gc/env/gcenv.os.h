@@ -54,6 +54,9 @@ struct VirtualReserveFlags
     {
         None = 0,
         WriteWatch = 1,
+        // Hint that the range should be backed by large pages as it gets
+        // committed, where the OS can do that transparently.
+        TransparentLargePages = 2,
     };
 };
 
@@ -296,9 +299,10 @@ public:
     // Parameters:
     //  address - starting virtual address
     //  size    - size of the virtual memory range
+    //  flags   - the VirtualReserveFlags the range was reserved with
     // Return:
     //  true if it has succeeded, false if it has failed
-    static bool VirtualDecommit(void *address, size_t size);
+    static bool VirtualDecommit(void *address, size_t size, uint32_t flags = VirtualReserveFlags::None);
 
     // Reset virtual memory range. Indicates that data in the memory range specified by address and size is no 
     // longer of interest, but it should not be decommitted.
@@ -355,6 +359,9 @@ public:
     // Check if the OS supports getting current processor number
     static bool CanGetCurrentProcessorNumber();
 
+    // Check if the OS can honour VirtualReserveFlags::TransparentLargePages
+    static bool CanUseTransparentLargePages();
+
     // Set ideal processor for the current thread
     // Parameters:
     //  srcProcNo - processor number the thread currently runs on
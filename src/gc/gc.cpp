@@ -80,6 +80,15 @@ static size_t smoothed_desired_per_heap = 0;
 uint32_t yp_spin_count_unit = 0;
 size_t loh_size_threshold = LARGE_OBJECT_SIZE;
 
+// When non zero, the ephemeral segment is committed and decommitted in
+// units of this many bytes (see GCRegionSize) instead of the page based
+// thresholds in grow_heap_segment/decommit_heap_segment_pages.
+size_t ephemeral_region_size = 0;
+
+// This is what we align reservations to and use as the default region size
+// when we use transparent large pages.
+const size_t transparent_large_page_size = 2*1024*1024;
+
 #ifdef GC_CONFIG_DRIVEN
 int compact_ratio = 0;
 #endif //GC_CONFIG_DRIVEN
@@ -1616,7 +1625,7 @@ int mark_time, plan_time, sweep_time, reloc_time, compact_time;
 
 #endif // MULTIPLE_HEAPS
 
-void reset_memory (uint8_t* o, size_t sizeo);
+size_t reset_memory (uint8_t* o, size_t sizeo);
 
 #ifdef WRITE_WATCH
 
@@ -2215,6 +2224,9 @@ uint8_t* gc_heap::pad_for_alignment_large (uint8_t* newAlloc, int requiredAlignm
 #define CLR_SIZE ((size_t)(8*1024))
 #endif //SERVER_GC
 
+// With GCAdaptiveAllocQuantum, the most a thread's allocation quantum can grow by.
+const size_t max_adaptive_allocation_quantum_factor = 8;
+
 #define END_SPACE_AFTER_GC (loh_size_threshold + MAX_STRUCTALIGN)
 
 #ifdef BACKGROUND_GC
@@ -2262,8 +2274,8 @@ size_t align_on_segment_hard_limit (size_t add)
 
 #endif //SERVER_GC
 
-//amount in bytes of the etw allocation tick
-const size_t etw_allocation_tick = 100*1024;
+//default amount in bytes of the etw allocation tick
+const size_t default_etw_allocation_tick = 100*1024;
 
 const size_t low_latency_alloc = 256*1024;
 
@@ -2282,6 +2294,8 @@ const int max_snoop_level = 128;
 
 #define GC_EPHEMERAL_DECOMMIT_TIMEOUT 5000
 
+#define GC_TRIM_FREE_SPACE_TIMEOUT 5000
+
 inline
 size_t align_on_page (size_t add)
 {
@@ -2306,6 +2320,17 @@ uint8_t* align_lower_page (uint8_t* add)
     return (uint8_t*)align_lower_page ((size_t)add);
 }
 
+// Rounds add up to the next ephemeral region boundary. Regions are counted
+// from the first page of the segment starting at seg_mem.
+inline
+uint8_t* align_on_region (uint8_t* seg_mem, uint8_t* add)
+{
+    assert (ephemeral_region_size != 0);
+    uint8_t* base = align_lower_page (seg_mem);
+    size_t offset = (size_t)(add - base);
+    return base + ((offset + ephemeral_region_size - 1) & ~(ephemeral_region_size - 1));
+}
+
 inline
 size_t align_write_watch_lower_page (size_t add)
 {
@@ -2518,8 +2543,26 @@ gc_heap**   gc_heap::g_heaps;
 
 size_t*     gc_heap::g_promoted;
 
+int         gc_heap::loh_remote_node_imbalance_percent = 150;
+
+int         gc_heap::n_active_heaps;
+
+bool        gc_heap::dynamic_heap_count_p = false;
+
+size_t      gc_heap::dynamic_heap_count_gc_percent = 5;
+
+size_t      gc_heap::dhc_sample_start_time = 0;
+
+size_t      gc_heap::dhc_sample_gc_elapsed_time = 0;
+
+size_t      gc_heap::dhc_sample_gc_count = 0;
+
 #ifdef MH_SC_MARK
 int*        gc_heap::g_mark_stack_busy;
+
+gc_mark_steal_mode gc_heap::mark_steal_mode = mark_steal_full_gc;
+
+size_t      gc_heap::mark_steal_threshold = 0;
 #endif //MH_SC_MARK
 
 
@@ -2590,12 +2633,36 @@ uint32_t    gc_heap::m_high_memory_load_th;
 
 uint32_t    gc_heap::v_high_memory_load_th;
 
+int         gc_heap::conserve_mem_setting = 0;
+
 uint64_t    gc_heap::total_physical_mem = 0;
 
 uint64_t    gc_heap::entry_available_physical_mem = 0;
 
 size_t      gc_heap::heap_hard_limit = 0;
 
+size_t      gc_heap::pause_goal_ms = 0;
+
+bool        gc_heap::gen0_prezero_p = false;
+
+bool        gc_heap::trim_on_high_memory_load_p = false;
+
+bool        gc_heap::adaptive_allocation_quantum_p = false;
+
+uint64_t    gc_heap::last_trim_free_space_time = 0;
+
+size_t      gc_heap::trim_free_space_count = 0;
+
+size_t      gc_heap::trim_free_space_decommitted = 0;
+
+size_t      gc_heap::trim_free_space_reset = 0;
+
+size_t      gc_heap::etw_allocation_tick = default_etw_allocation_tick;
+
+#ifdef VERIFY_HEAP
+size_t      gc_heap::heap_verify_sample_objects = 0;
+#endif //VERIFY_HEAP
+
 bool        affinity_config_specified_p = false;
 #ifdef BACKGROUND_GC
 GCEvent     gc_heap::bgc_start_event;
@@ -2610,6 +2677,8 @@ bool        gc_heap::gc_can_use_concurrent = false;
 
 bool        gc_heap::temp_disable_concurrent_p = false;
 
+bool        gc_heap::high_frag_blocking_gen2_p = true;
+
 uint32_t    gc_heap::cm_in_progress = FALSE;
 
 BOOL        gc_heap::dont_restart_ee_p = FALSE;
@@ -2708,6 +2777,18 @@ gen_to_condemn_tuning gc_heap::gen_to_condemn_reasons;
 
 size_t      gc_heap::etw_allocation_running_amount[2];
 
+#ifdef VERIFY_HEAP
+uint64_t    gc_heap::verify_sample_rand_state = 0;
+#endif //VERIFY_HEAP
+
+#ifdef FEATURE_EVENT_TRACE
+type_survival_entry* gc_heap::type_survival_table = 0;
+
+uint64_t*   gc_heap::type_survival_rows = 0;
+
+bool        gc_heap::type_survival_p = false;
+#endif //FEATURE_EVENT_TRACE
+
 uint64_t    gc_heap::total_alloc_bytes_soh = 0;
 
 uint64_t    gc_heap::total_alloc_bytes_loh = 0;
@@ -2912,6 +2993,7 @@ uint64_t gc_heap::total_loh_a_last_bgc = 0;
 size_t gc_heap::eph_gen_starts_size = 0;
 heap_segment* gc_heap::segment_standby_list;
 bool          gc_heap::use_large_pages_p = 0;
+bool          gc_heap::use_transparent_large_pages_p = false;
 size_t        gc_heap::last_gc_index = 0;
 #ifdef HEAP_BALANCE_INSTRUMENTATION
 size_t        gc_heap::last_gc_end_time_ms = 0;
@@ -2933,6 +3015,7 @@ size_t gc_heap::compact_or_sweep_gcs[2];
 #ifdef FEATURE_LOH_COMPACTION
 BOOL                   gc_heap::loh_compaction_always_p = FALSE;
 gc_loh_compaction_mode gc_heap::loh_compaction_mode = loh_compaction_default;
+uint32_t               gc_heap::loh_compaction_frag_percent = 0;
 int                    gc_heap::loh_pinned_queue_decay = LOH_PIN_DECAY;
 
 #endif //FEATURE_LOH_COMPACTION
@@ -2980,6 +3063,8 @@ uint8_t* gc_heap::alloc_allocated = 0;
 
 size_t gc_heap::allocation_quantum = CLR_SIZE;
 
+size_t gc_heap::max_allocation_quantum = CLR_SIZE;
+
 GCSpinLock gc_heap::more_space_lock_soh;
 GCSpinLock gc_heap::more_space_lock_loh;
 VOLATILE(int32_t) gc_heap::loh_alloc_thread_count = 0;
@@ -3022,7 +3107,9 @@ generation gc_heap::generation_table [NUMBERGENERATIONS + 1];
 
 size_t     gc_heap::interesting_data_per_heap[max_idp_count];
 
-size_t     gc_heap::compact_reasons_per_heap[max_compact_reasons_count];
+size_t     gc_heap::compact_reasons_per_heap[max_dac_compact_reasons_count];
+
+size_t     gc_heap::compact_conserve_mem_count;
 
 size_t     gc_heap::expand_mechanisms_per_heap[max_expand_mechanisms_count];
 
@@ -3103,7 +3190,7 @@ void gc_history_per_heap::print()
         gen_data[i].print (heap_index, i);
     }
 
-    dprintf (DT_LOG_0, ("fla %Id flr %Id esa %Id ca %Id pa %Id paa %Id, rfle %d, ec %Id", 
+    dprintf (DT_LOG_0, ("fla %Id flr %Id esa %Id ca %Id pa %Id paa %Id, rfle %d, ec %Id, lrn %Id", 
                     maxgen_size_info.free_list_allocated,
                     maxgen_size_info.free_list_rejected,
                     maxgen_size_info.end_seg_allocated,
@@ -3111,7 +3198,8 @@ void gc_history_per_heap::print()
                     maxgen_size_info.pinned_allocated,
                     maxgen_size_info.pinned_allocated_advance,
                     maxgen_size_info.running_free_list_efficiency,
-                    extra_gen0_committed));
+                    extra_gen0_committed,
+                    loh_alloc_remote_node_count));
 
     int mechanism = 0;
     gc_mechanism_descr* descr = 0;
@@ -4587,16 +4675,22 @@ void* virtual_alloc (size_t size, bool use_large_pages_p)
     }
 
     uint32_t flags = VirtualReserveFlags::None;
+    size_t alignment = card_size * card_word_width;
 #ifndef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     if (virtual_alloc_hardware_write_watch)
     {
         flags = VirtualReserveFlags::WriteWatch;
     }
 #endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    if (gc_heap::use_transparent_large_pages_p)
+    {
+        flags |= VirtualReserveFlags::TransparentLargePages;
+        alignment = max (alignment, transparent_large_page_size);
+    }
 
     void* prgmem = use_large_pages_p ? 
         GCToOSInterface::VirtualReserveAndCommitLargePages(requested_size) : 
-        GCToOSInterface::VirtualReserve(requested_size, card_size * card_word_width, flags);
+        GCToOSInterface::VirtualReserve(requested_size, alignment, flags);
     void *aligned_mem = prgmem;
 
     // We don't want (prgmem + size) to be right at the end of the address space 
@@ -6041,7 +6135,11 @@ bool gc_heap::virtual_decommit (void* address, size_t size, int h_number)
     assert (heap_hard_limit == 0);
 #endif //!BIT64
 
-    bool decommit_succeeded_p = GCToOSInterface::VirtualDecommit (address, size);
+    // Everything decommitted through here lives in ranges that were reserved with
+    // TransparentLargePages when we use them.
+    uint32_t flags = (use_transparent_large_pages_p ?
+        VirtualReserveFlags::TransparentLargePages : VirtualReserveFlags::None);
+    bool decommit_succeeded_p = GCToOSInterface::VirtualDecommit (address, size, flags);
 
     if (decommit_succeeded_p && heap_hard_limit)
     {
@@ -7676,6 +7774,11 @@ uint32_t* gc_heap::make_card_table (uint8_t* start, uint8_t* end)
     }
 #endif //CARD_BUNDLE
 
+    if (use_transparent_large_pages_p)
+    {
+        virtual_reserve_flags |= VirtualReserveFlags::TransparentLargePages;
+    }
+
     size_t wws = 0;
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     size_t sw_ww_table_offset = 0;
@@ -7879,6 +7982,11 @@ int gc_heap::grow_brick_card_tables (uint8_t* start,
         }
 #endif //CARD_BUNDLE
 
+        if (gc_heap::use_transparent_large_pages_p)
+        {
+            virtual_reserve_flags |= VirtualReserveFlags::TransparentLargePages;
+        }
+
         size_t wws = 0;
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         size_t sw_ww_table_offset = 0;
@@ -9850,6 +9958,29 @@ void gc_heap::decommit_heap_segment_pages (heap_segment* seg,
     uint8_t*  page_start = align_on_page (heap_segment_allocated(seg));
     size_t size = heap_segment_committed (seg) - page_start;
     extra_space = align_on_page (extra_space);
+
+    if (ephemeral_region_size && (seg == ephemeral_heap_segment))
+    {
+        // Only ever give back whole regions - keep the region allocated and the
+        // slack fall into committed.
+        uint8_t* decommit_start = align_on_region (heap_segment_mem (seg), page_start + extra_space);
+        if (decommit_start < heap_segment_committed (seg))
+        {
+            size = heap_segment_committed (seg) - decommit_start;
+            virtual_decommit (decommit_start, size, heap_number);
+            dprintf (3, ("Decommitting ephemeral regions [%Ix, %Ix[(%d)",
+                (size_t)decommit_start,
+                (size_t)(decommit_start + size),
+                size));
+            heap_segment_committed (seg) = decommit_start;
+            if (heap_segment_used (seg) > heap_segment_committed (seg))
+            {
+                heap_segment_used (seg) = heap_segment_committed (seg);
+            }
+        }
+        return;
+    }
+
     if (size >= max ((extra_space + 2*OS_PAGE_SIZE), 100*OS_PAGE_SIZE))
     {
         page_start += max(extra_space, 32*OS_PAGE_SIZE);
@@ -10354,6 +10485,8 @@ void gc_heap::make_generation (generation& gen, heap_segment* seg, uint8_t* star
     gen.pinned_allocation_compact_size = 0;
     gen.allocate_end_seg_p = FALSE;
     gen.free_list_allocator.clear();
+    memset (gen.gen_free_list_bucket_hits, 0, sizeof (gen.gen_free_list_bucket_hits));
+    memset (gen.gen_free_list_bucket_misses, 0, sizeof (gen.gen_free_list_bucket_misses));
 
 #ifdef FREE_USAGE_STATS
     memset (gen.gen_free_spaces, 0, sizeof (gen.gen_free_spaces));
@@ -10538,6 +10671,8 @@ HRESULT gc_heap::initialize_gc (size_t segment_size,
     {
         gc_can_use_concurrent = false;
     }
+
+    high_frag_blocking_gen2_p = GCConfig::GetHighFragBlockingGen2();
 #endif //BACKGROUND_GC
 #endif //WRITE_WATCH
 
@@ -10625,9 +10760,25 @@ HRESULT gc_heap::initialize_gc (size_t segment_size,
     if (!g_promoted || !g_bpromoted)
         return E_OUTOFMEMORY;
 
+    // A negative imbalance would make remote heaps preferred over local ones, and a
+    // huge one would overflow the delta; either way keep the percent in range.
+    int64_t loh_remote_node_imbalance_from_config = GCConfig::GetGCLOHRemoteNodeImbalance();
+    loh_remote_node_imbalance_percent = static_cast<int>(min (max (loh_remote_node_imbalance_from_config, (int64_t)0), (int64_t)10000));
+
+    n_active_heaps = n_heaps;
+    dynamic_heap_count_p = GCConfig::GetDynamicHeapCount();
+    dynamic_heap_count_gc_percent = static_cast<size_t>(GCConfig::GetDynamicHeapCountGCPercent());
+
 #ifdef MH_SC_MARK
     if (!g_mark_stack_busy)
         return E_OUTOFMEMORY;
+
+    int mark_steal_mode_from_config = static_cast<int>(GCConfig::GetGCMarkStealMode());
+    if ((mark_steal_mode_from_config >= mark_steal_never) && (mark_steal_mode_from_config <= mark_steal_all_gcs))
+    {
+        mark_steal_mode = (gc_mark_steal_mode)mark_steal_mode_from_config;
+    }
+    mark_steal_threshold = static_cast<size_t>(GCConfig::GetGCMarkStealThreshold());
 #endif //MH_SC_MARK
 
     if (!create_thread_support (number_of_heaps))
@@ -10644,6 +10795,21 @@ HRESULT gc_heap::initialize_gc (size_t segment_size,
     yp_spin_count_unit = 32 * g_num_processors;
 #endif //MULTIPLE_HEAPS
 
+    pause_goal_ms = static_cast<size_t>(GCConfig::GetGCPauseGoalMs());
+    gen0_prezero_p = GCConfig::GetGCGen0PreZero();
+    trim_on_high_memory_load_p = GCConfig::GetGCTrimOnHighMemoryLoad();
+    adaptive_allocation_quantum_p = GCConfig::GetGCAdaptiveAllocQuantum();
+
+#ifdef VERIFY_HEAP
+    heap_verify_sample_objects = static_cast<size_t>(GCConfig::GetHeapVerifySampleObjects());
+#endif //VERIFY_HEAP
+
+    size_t allocation_tick_kb = static_cast<size_t>(GCConfig::GetGCAllocationTickKB());
+    if (allocation_tick_kb)
+    {
+        etw_allocation_tick = allocation_tick_kb * 1024;
+    }
+
 #if defined(__linux__)
     GCToEEInterface::UpdateGCEventStatus(static_cast<int>(GCEventStatus::GetEnabledLevel(GCEventProvider_Default)),
                                          static_cast<int>(GCEventStatus::GetEnabledKeywords(GCEventProvider_Default)),
@@ -10739,11 +10905,37 @@ gc_heap::init_semi_shared()
 #ifdef FEATURE_LOH_COMPACTION
     loh_compaction_always_p = GCConfig::GetLOHCompactionMode() != 0;
     loh_compaction_mode = loh_compaction_default;
+    {
+        int64_t frag_percent = GCConfig::GetLOHCompactionFragPercent();
+        loh_compaction_frag_percent = ((frag_percent > 0) && (frag_percent <= 100)) ? (uint32_t)frag_percent : 0;
+    }
 #endif //FEATURE_LOH_COMPACTION
 
     loh_size_threshold = (size_t)GCConfig::GetLOHThreshold();
     assert (loh_size_threshold >= LARGE_OBJECT_SIZE);
 
+    {
+        size_t region_size_from_config = (size_t)GCConfig::GetRegionSize();
+        if ((region_size_from_config == 0) && use_transparent_large_pages_p)
+        {
+            // Don't break up large pages when we decommit.
+            region_size_from_config = transparent_large_page_size;
+        }
+        if (region_size_from_config != 0)
+        {
+            // Regions are a power of 2 number of pages and never smaller than what
+            // we would commit in one go anyway.
+            region_size_from_config = max (region_size_from_config, (size_t)commit_min_th);
+            size_t region_size = commit_min_th;
+            while ((region_size < region_size_from_config) && (region_size < (soh_segment_size / 2)))
+            {
+                region_size *= 2;
+            }
+            ephemeral_region_size = region_size;
+        }
+        dprintf (GTC_LOG, ("ephemeral region size is %Id", ephemeral_region_size));
+    }
+
 #ifdef BGC_SERVO_TUNING
     memset (bgc_tuning::gen_calc, 0, sizeof (bgc_tuning::gen_calc));
     memset (bgc_tuning::gen_stats, 0, sizeof (bgc_tuning::gen_stats));
@@ -10887,6 +11079,7 @@ gc_heap* gc_heap::make_gc_heap (
 
     res->vm_heap = vm_hp;
     res->alloc_context_count = 0;
+    res->loh_alloc_remote_node_count = 0;
 
 #ifdef MARK_LIST
 #ifdef PARALLEL_MARK_LIST_SORT
@@ -11125,6 +11318,8 @@ gc_heap::init_gc_heap (int  h_number)
 
     allocation_quantum = CLR_SIZE;
 
+    max_allocation_quantum = CLR_SIZE;
+
     more_space_lock_soh = gc_lock;
 
     more_space_lock_loh = gc_lock;
@@ -11297,6 +11492,16 @@ gc_heap::init_gc_heap (int  h_number)
         return 0;
     }
 
+#ifdef VERIFY_HEAP
+    verify_sample_rand_state = (uint64_t)heap_number;
+#endif //VERIFY_HEAP
+
+#ifdef FEATURE_EVENT_TRACE
+    type_survival_table = 0;
+    type_survival_rows = 0;
+    type_survival_p = false;
+#endif //FEATURE_EVENT_TRACE
+
     etw_allocation_running_amount[0] = 0;
     etw_allocation_running_amount[1] = 0;
     total_alloc_bytes_soh = 0;
@@ -11443,6 +11648,7 @@ gc_heap::init_gc_heap (int  h_number)
 #ifdef GC_CONFIG_DRIVEN
     memset (interesting_data_per_heap, 0, sizeof (interesting_data_per_heap));
     memset(compact_reasons_per_heap, 0, sizeof (compact_reasons_per_heap));
+    compact_conserve_mem_count = 0;
     memset(expand_mechanisms_per_heap, 0, sizeof (expand_mechanisms_per_heap));
     memset(interesting_mechanism_bits_per_heap, 0, sizeof (interesting_mechanism_bits_per_heap));
 #endif //GC_CONFIG_DRIVEN
@@ -11625,6 +11831,12 @@ BOOL gc_heap::grow_heap_segment (heap_segment* seg, uint8_t* high_address, bool*
 
     size_t c_size = align_on_page ((size_t)(high_address - heap_segment_committed (seg)));
     c_size = max (c_size, commit_min_th);
+    if (ephemeral_region_size && (seg == ephemeral_heap_segment))
+    {
+        // Commit up to the end of the region high_address falls into.
+        uint8_t* region_end = align_on_region (heap_segment_mem (seg), heap_segment_committed (seg) + c_size);
+        c_size = (size_t)(region_end - heap_segment_committed (seg));
+    }
     c_size = min (c_size, (size_t)(heap_segment_reserved (seg) - heap_segment_committed (seg)));
 
     if (c_size == 0)
@@ -11958,19 +12170,27 @@ void allocator::thread_free_item (uint8_t* item, uint8_t*& head, uint8_t*& tail)
     tail = item;
 }
 
-void allocator::thread_item (uint8_t* item, size_t size)
+// Bucket 0 has items smaller than the first bucket size and bucket n (except for
+// the last one which has everything that's bigger) has items in
+// [first_bucket_size * 2^(n-1), first_bucket_size * 2^n[ so we can get to the
+// bucket directly from the highest bit of the size.
+inline
+unsigned int allocator::first_suitable_bucket (size_t size)
 {
-    size_t sz = frst_bucket_size;
-    unsigned int a_l_number = 0; 
-
-    for (; a_l_number < (num_buckets-1); a_l_number++)
+    if ((num_buckets == 1) || (size < frst_bucket_size))
     {
-        if (size < sz)
-        {
-            break;
-        }
-        sz = sz * 2;
+        return 0;
     }
+
+    assert (power_of_two_p (frst_bucket_size));
+    unsigned int a_l_number = (unsigned int)(index_of_highest_set_bit (size) - 
+                                             index_of_highest_set_bit (frst_bucket_size) + 1);
+    return min (a_l_number, (unsigned int)(num_buckets - 1));
+}
+
+void allocator::thread_item (uint8_t* item, size_t size)
+{
+    unsigned int a_l_number = first_suitable_bucket (size);
     alloc_list* al = &alloc_list_of (a_l_number);
     thread_free_item (item, 
                       al->alloc_list_head(),
@@ -11980,16 +12200,7 @@ void allocator::thread_item (uint8_t* item, size_t size)
 void allocator::thread_item_front (uint8_t* item, size_t size)
 {
     //find right free list
-    size_t sz = frst_bucket_size;
-    unsigned int a_l_number = 0; 
-    for (; a_l_number < (num_buckets-1); a_l_number++)
-    {
-        if (size < sz)
-        {
-            break;
-        }
-        sz = sz * 2;
-    }
+    unsigned int a_l_number = first_suitable_bucket (size);
     alloc_list* al = &alloc_list_of (a_l_number);
     free_list_slot (item) = al->alloc_list_head();
     free_list_undo (item) = UNDO_EMPTY;
@@ -12297,8 +12508,25 @@ size_t gc_heap::new_allocation_limit (size_t size, size_t physical_limit, int ge
     return limit;
 }
 
+// With GCAdaptiveAllocQuantum a thread that keeps coming back for more gen0
+// space between GCs gets a bigger quantum, up to its share of the budget, so it
+// takes the allocation lock less often. alloc_count is reset at every GC so
+// everyone starts with the same quantum again.
+size_t gc_heap::get_allocation_quantum (alloc_context* acontext)
+{
+    size_t quantum = allocation_quantum;
+
+    if (adaptive_allocation_quantum_p && acontext)
+    {
+        size_t factor = min ((size_t)(1 + (acontext->alloc_count / 16)), (size_t)max_adaptive_allocation_quantum_factor);
+        quantum = Align (max (quantum, min (quantum * factor, max_allocation_quantum)), get_alignment_constant (TRUE));
+    }
+
+    return quantum;
+}
+
 size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_limit, int gen_number,
-                                 int align_const)
+                                 int align_const, alloc_context* acontext)
 {
     size_t padded_size = size + Align (min_obj_size, align_const);
     // for LOH this is not true...we could select a physical_limit that's exactly the same
@@ -12307,7 +12535,7 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
 
     // For SOH if the size asked for is very small, we want to allocate more than just what's asked for if possible. 
     // Unless we were told not to clean, then we will not force it.
-    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? allocation_quantum : 0);
+    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? get_allocation_quantum (acontext) : 0);
 
     size_t desired_size_to_allocate  = max (padded_size, min_size_to_allocate);
     size_t new_physical_limit = min (physical_limit, desired_size_to_allocate);
@@ -12654,66 +12882,62 @@ BOOL gc_heap::a_fit_free_list_p (int gen_number,
     BOOL can_fit = FALSE;
     generation* gen = generation_of (gen_number);
     allocator* gen_allocator = generation_allocator (gen);
-    size_t sz_list = gen_allocator->first_bucket_size();
-    for (unsigned int a_l_idx = 0; a_l_idx < gen_allocator->number_of_buckets(); a_l_idx++)
+    for (unsigned int a_l_idx = gen_allocator->first_suitable_bucket (size); 
+         a_l_idx < gen_allocator->number_of_buckets(); a_l_idx++)
     {
-        if ((size < sz_list) || (a_l_idx == (gen_allocator->number_of_buckets()-1)))
-        {
-            uint8_t* free_list = gen_allocator->alloc_list_head_of (a_l_idx);
-            uint8_t* prev_free_item = 0;
+        uint8_t* free_list = gen_allocator->alloc_list_head_of (a_l_idx);
+        uint8_t* prev_free_item = 0;
 
-            while (free_list != 0)
+        while (free_list != 0)
+        {
+            dprintf (3, ("considering free list %Ix", (size_t)free_list));
+            size_t free_list_size = unused_array_size (free_list);
+            if ((size + Align (min_obj_size, align_const)) <= free_list_size)
             {
-                dprintf (3, ("considering free list %Ix", (size_t)free_list));
-                size_t free_list_size = unused_array_size (free_list);
-                if ((size + Align (min_obj_size, align_const)) <= free_list_size)
-                {
-                    dprintf (3, ("Found adequate unused area: [%Ix, size: %Id",
-                                 (size_t)free_list, free_list_size));
-
-                    gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
-                    // We ask for more Align (min_obj_size)
-                    // to make sure that we can insert a free object
-                    // in adjust_limit will set the limit lower
-                    size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const);
-
-                    uint8_t*  remain = (free_list + limit);
-                    size_t remain_size = (free_list_size - limit);
-                    if (remain_size >= Align(min_free_list, align_const))
-                    {
-                        make_unused_array (remain, remain_size);
-                        gen_allocator->thread_item_front (remain, remain_size);
-                        assert (remain_size >= Align (min_obj_size, align_const));
-                    }
-                    else
-                    {
-                        //absorb the entire free list
-                        limit += remain_size;
-                    }
-                    generation_free_list_space (gen) -= limit;
+                dprintf (3, ("Found adequate unused area: [%Ix, size: %Id",
+                             (size_t)free_list, free_list_size));
 
-                    adjust_limit_clr (free_list, limit, size, acontext, flags, 0, align_const, gen_number);
+                gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
+                // We ask for more Align (min_obj_size)
+                // to make sure that we can insert a free object
+                // in adjust_limit will set the limit lower
+                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const, acontext);
 
-                    can_fit = TRUE;
-                    goto end;
-                }
-                else if (gen_allocator->discard_if_no_fit_p())
+                uint8_t*  remain = (free_list + limit);
+                size_t remain_size = (free_list_size - limit);
+                if (remain_size >= Align(min_free_list, align_const))
                 {
-                    assert (prev_free_item == 0);
-                    dprintf (3, ("couldn't use this free area, discarding"));
-                    generation_free_obj_space (gen) += free_list_size;
-
-                    gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
-                    generation_free_list_space (gen) -= free_list_size;
+                    make_unused_array (remain, remain_size);
+                    gen_allocator->thread_item_front (remain, remain_size);
+                    assert (remain_size >= Align (min_obj_size, align_const));
                 }
                 else
                 {
-                    prev_free_item = free_list;
+                    //absorb the entire free list
+                    limit += remain_size;
                 }
-                free_list = free_list_slot (free_list); 
+                generation_free_list_space (gen) -= limit;
+
+                adjust_limit_clr (free_list, limit, size, acontext, flags, 0, align_const, gen_number);
+
+                can_fit = TRUE;
+                goto end;
+            }
+            else if (gen_allocator->discard_if_no_fit_p())
+            {
+                assert (prev_free_item == 0);
+                dprintf (3, ("couldn't use this free area, discarding"));
+                generation_free_obj_space (gen) += free_list_size;
+
+                gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
+                generation_free_list_space (gen) -= free_list_size;
+            }
+            else
+            {
+                prev_free_item = free_list;
             }
+            free_list = free_list_slot (free_list); 
         }
-        sz_list = sz_list * 2;
     }
 end:
     return can_fit;
@@ -12817,84 +13041,82 @@ BOOL gc_heap::a_fit_free_list_large_p (size_t size,
 #ifdef BACKGROUND_GC
     int cookie = -1;
 #endif //BACKGROUND_GC
-    size_t sz_list = loh_allocator->first_bucket_size();
-    for (unsigned int a_l_idx = 0; a_l_idx < loh_allocator->number_of_buckets(); a_l_idx++)
+    for (unsigned int a_l_idx = loh_allocator->first_suitable_bucket (size); 
+         a_l_idx < loh_allocator->number_of_buckets(); a_l_idx++)
     {
-        if ((size < sz_list) || (a_l_idx == (loh_allocator->number_of_buckets()-1)))
+        uint8_t* free_list = loh_allocator->alloc_list_head_of (a_l_idx);
+        uint8_t* prev_free_item = 0;
+        while (free_list != 0)
         {
-            uint8_t* free_list = loh_allocator->alloc_list_head_of (a_l_idx);
-            uint8_t* prev_free_item = 0;
-            while (free_list != 0)
-            {
-                dprintf (3, ("considering free list %Ix", (size_t)free_list));
+            dprintf (3, ("considering free list %Ix", (size_t)free_list));
 
-                size_t free_list_size = unused_array_size(free_list);
+            size_t free_list_size = unused_array_size(free_list);
 
 #ifdef FEATURE_LOH_COMPACTION
-                if ((size + loh_pad) <= free_list_size)
+            if ((size + loh_pad) <= free_list_size)
 #else
-                if (((size + Align (min_obj_size, align_const)) <= free_list_size)||
-                    (size == free_list_size))
+            if (((size + Align (min_obj_size, align_const)) <= free_list_size)||
+                (size == free_list_size))
 #endif //FEATURE_LOH_COMPACTION
-                {
+            {
+                gen->gen_free_list_bucket_hits[a_l_idx]++;
 #ifdef BACKGROUND_GC
-                    cookie = bgc_alloc_lock->loh_alloc_set (free_list);
-                    bgc_track_loh_alloc();
+                cookie = bgc_alloc_lock->loh_alloc_set (free_list);
+                bgc_track_loh_alloc();
 #endif //BACKGROUND_GC
 
-                    //unlink the free_item
-                    loh_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
+                //unlink the free_item
+                loh_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
 
-                    // Substract min obj size because limit_from_size adds it. Not needed for LOH
-                    size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size, 
-                                                    gen_number, align_const);
+                // Substract min obj size because limit_from_size adds it. Not needed for LOH
+                size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size, 
+                                                gen_number, align_const, acontext);
 
 #ifdef FEATURE_LOH_COMPACTION
-                    make_unused_array (free_list, loh_pad);
-                    limit -= loh_pad;
-                    free_list += loh_pad;
-                    free_list_size -= loh_pad;
+                make_unused_array (free_list, loh_pad);
+                limit -= loh_pad;
+                free_list += loh_pad;
+                free_list_size -= loh_pad;
 #endif //FEATURE_LOH_COMPACTION
 
-                    uint8_t*  remain = (free_list + limit);
-                    size_t remain_size = (free_list_size - limit);
-                    if (remain_size != 0)
-                    {
-                        assert (remain_size >= Align (min_obj_size, align_const));
-                        make_unused_array (remain, remain_size);
-                    }
-                    if (remain_size >= Align(min_free_list, align_const))
-                    {
-                        loh_thread_gap_front (remain, remain_size, gen);
-                        assert (remain_size >= Align (min_obj_size, align_const));
-                    }
-                    else
-                    {
-                        generation_free_obj_space (gen) += remain_size;
-                    }
-                    generation_free_list_space (gen) -= free_list_size;
-                    dprintf (3, ("found fit on loh at %Ix", free_list));
+                uint8_t*  remain = (free_list + limit);
+                size_t remain_size = (free_list_size - limit);
+                if (remain_size != 0)
+                {
+                    assert (remain_size >= Align (min_obj_size, align_const));
+                    make_unused_array (remain, remain_size);
+                }
+                if (remain_size >= Align(min_free_list, align_const))
+                {
+                    loh_thread_gap_front (remain, remain_size, gen);
+                    assert (remain_size >= Align (min_obj_size, align_const));
+                }
+                else
+                {
+                    generation_free_obj_space (gen) += remain_size;
+                }
+                generation_free_list_space (gen) -= free_list_size;
+                dprintf (3, ("found fit on loh at %Ix", free_list));
 #ifdef BACKGROUND_GC
-                    if (cookie != -1)
-                    {
-                        bgc_loh_alloc_clr (free_list, limit, acontext, flags, align_const, cookie, FALSE, 0);
-                    }
-                    else
+                if (cookie != -1)
+                {
+                    bgc_loh_alloc_clr (free_list, limit, acontext, flags, align_const, cookie, FALSE, 0);
+                }
+                else
 #endif //BACKGROUND_GC
-                    {
-                        adjust_limit_clr (free_list, limit, size, acontext, flags, 0, align_const, gen_number);
-                    }
-
-                    //fix the limit to compensate for adjust_limit_clr making it too short 
-                    acontext->alloc_limit += Align (min_obj_size, align_const);
-                    can_fit = TRUE;
-                    goto exit;
+                {
+                    adjust_limit_clr (free_list, limit, size, acontext, flags, 0, align_const, gen_number);
                 }
-                prev_free_item = free_list;
-                free_list = free_list_slot (free_list); 
+
+                //fix the limit to compensate for adjust_limit_clr making it too short 
+                acontext->alloc_limit += Align (min_obj_size, align_const);
+                can_fit = TRUE;
+                goto exit;
             }
+            gen->gen_free_list_bucket_misses[a_l_idx]++;
+            prev_free_item = free_list;
+            free_list = free_list_slot (free_list); 
         }
-        sz_list = sz_list * 2;
     }
 exit:
     return can_fit;
@@ -12940,7 +13162,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
         limit = limit_from_size (size, 
                                  flags,
                                  (end - allocated), 
-                                 gen_number, align_const);
+                                 gen_number, align_const, acontext);
         goto found_fit;
     }
 
@@ -12951,7 +13173,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
         limit = limit_from_size (size, 
                                  flags,
                                  (end - allocated), 
-                                 gen_number, align_const);
+                                 gen_number, align_const, acontext);
 
         if (grow_heap_segment (seg, (allocated + limit), &hard_limit_short_seg_end_p))
         {
@@ -14186,13 +14408,78 @@ allocation_state gc_heap::try_allocate_more_space (alloc_context* acontext, size
 }
 
 #ifdef MULTIPLE_HEAPS
+// Maps a heap picked for an allocating thread onto one of the heaps we are
+// currently allocating on. We stay on the same NUMA node if that node has any
+// active heaps; only if it has none do we spread over all the active heaps.
+inline
+int gc_heap::get_active_heap_no (int hp_num)
+{
+    if (hp_num < n_active_heaps)
+        return hp_num;
+
+    int start, end;
+    heap_select::get_heap_range_for_heap (hp_num, &start, &end);
+    int active_end = min (end, n_active_heaps);
+
+    if (start < active_end)
+        return (start + ((hp_num - start) % (active_end - start)));
+
+    return (hp_num % n_active_heaps);
+}
+
+// Called on heap 0 at the end of each blocking GC when GCDynamicHeapCount is
+// enabled. Every dhc_sample_gcs GCs we look at the percentage of time spent
+// in GCs: if it's above the goal we allocate on more heaps, if it's well
+// below it we allocate on fewer heaps which means fewer gen0 budgets.
+// Allocation contexts get reset at every GC so they'll pick their new home
+// heap on their next allocation.
+void gc_heap::adjust_dynamic_heap_count()
+{
+    const size_t dhc_sample_gcs = 10;
+    size_t now = GetHighPrecisionTimeStamp();
+
+    if (dhc_sample_start_time == 0)
+    {
+        dhc_sample_start_time = now;
+        return;
+    }
+
+    dhc_sample_gc_elapsed_time += dd_gc_elapsed_time (g_heaps[0]->dynamic_data_of (0));
+    dhc_sample_gc_count++;
+
+    if (dhc_sample_gc_count < dhc_sample_gcs)
+        return;
+
+    size_t sample_time = max ((now - dhc_sample_start_time), (size_t)1);
+    size_t gc_percent = dhc_sample_gc_elapsed_time * 100 / sample_time;
+    int new_n_active_heaps = n_active_heaps;
+
+    if (gc_percent > dynamic_heap_count_gc_percent)
+    {
+        new_n_active_heaps = min ((n_active_heaps * 2), n_heaps);
+    }
+    else if ((gc_percent * 4) < dynamic_heap_count_gc_percent)
+    {
+        new_n_active_heaps = max ((n_active_heaps - max ((n_active_heaps / 4), 1)), 1);
+    }
+
+    dprintf (GTC_LOG, ("%Id GCs took %Idms out of %Idms (%Id%%), active heaps %d->%d",
+        dhc_sample_gc_count, dhc_sample_gc_elapsed_time, sample_time, gc_percent,
+        n_active_heaps, new_n_active_heaps));
+
+    n_active_heaps = new_n_active_heaps;
+    dhc_sample_start_time = now;
+    dhc_sample_gc_elapsed_time = 0;
+    dhc_sample_gc_count = 0;
+}
+
 void gc_heap::balance_heaps (alloc_context* acontext)
 {
     if (acontext->alloc_count < 4)
     {
         if (acontext->alloc_count == 0)
         {
-            int home_hp_num = heap_select::select_heap (acontext);
+            int home_hp_num = get_active_heap_no (heap_select::select_heap (acontext));
             acontext->set_home_heap (GCHeap::GetHeap (home_hp_num));
             gc_heap* hp = acontext->get_home_heap ()->pGenGCHeap;
             acontext->set_alloc_heap (acontext->get_home_heap ());
@@ -14214,6 +14501,21 @@ void gc_heap::balance_heaps (alloc_context* acontext)
     }
     else
     {
+        gc_heap* alloc_hp = acontext->get_alloc_heap ()->pGenGCHeap;
+        if (alloc_hp->heap_number >= n_active_heaps)
+        {
+            // The heap this context allocates on is no longer active. The balancing
+            // below starts from it and only moves to a heap with more budget, so it
+            // could keep us there; move to an active heap on the same node instead.
+            int new_hp_num = get_active_heap_no (alloc_hp->heap_number);
+            alloc_hp->alloc_context_count--;
+            acontext->set_home_heap (GCHeap::GetHeap (new_hp_num));
+            acontext->set_alloc_heap (acontext->get_home_heap ());
+            acontext->get_home_heap ()->pGenGCHeap->alloc_context_count++;
+            acontext->alloc_count++;
+            return;
+        }
+
         BOOL set_home_heap = FALSE;
         gc_heap* home_hp = NULL;
         int proc_hp_num = 0;
@@ -14230,7 +14532,7 @@ void gc_heap::balance_heaps (alloc_context* acontext)
         {
             assert (acontext->get_home_heap () != NULL);
             home_hp = acontext->get_home_heap ()->pGenGCHeap;
-            proc_hp_num = heap_select::select_heap (acontext);
+            proc_hp_num = get_active_heap_no (heap_select::select_heap (acontext));
 
             if (acontext->get_home_heap () != GCHeap::GetHeap (proc_hp_num))
             {
@@ -14317,10 +14619,10 @@ try_again:
                         last_proc_no = proc_no;
                     }
 
-                    int current_hp_num = heap_select::proc_no_to_heap_no[proc_no];
+                    int current_hp_num = get_active_heap_no (heap_select::proc_no_to_heap_no[proc_no]);
                     acontext->set_home_heap (GCHeap::GetHeap (current_hp_num));
 #else
-                    acontext->set_home_heap (GCHeap::GetHeap (heap_select::select_heap (acontext)));
+                    acontext->set_home_heap (GCHeap::GetHeap (get_active_heap_no (heap_select::select_heap (acontext))));
 #endif //HEAP_BALANCE_INSTRUMENTATION
                     new_home_hp = acontext->get_home_heap ()->pGenGCHeap;
                     if (org_hp == new_home_hp)
@@ -14337,6 +14639,9 @@ try_again:
                     for (int i = start; i < end; i++)
                     {
                         gc_heap* hp = GCHeap::GetHeap (i % n_heaps)->pGenGCHeap;
+                        if (hp->heap_number >= n_active_heaps)
+                            continue;
+
                         dd = hp->dynamic_data_of (0);
                         ptrdiff_t size = dd_new_allocation (dd);
 
@@ -14487,15 +14792,25 @@ try_again:
     if ((max_hp == home_hp) && (end < finish))
     {
         start = end; end = finish;
-        delta = dd_min_size (dd) * 3 / 2; // Make it harder to balance to remote nodes on NUMA.
+        // Make it harder to balance to remote nodes on NUMA.
+        delta = dd_min_size (dd) / 100 * loh_remote_node_imbalance_percent;
         goto try_again;
     }
 
     if (max_hp != home_hp)
     {
-        dprintf (3, ("loh: %d(%Id)->%d(%Id)", 
+        // Many threads share a home heap, so this has to be interlocked.
+        bool remote_node_p = (heap_select::find_numa_node_from_heap_no (home_hp_num) != 
+                              heap_select::find_numa_node_from_heap_no (max_hp->heap_number));
+        if (remote_node_p)
+        {
+            Interlocked::Increment (&home_hp->loh_alloc_remote_node_count);
+        }
+
+        dprintf (3, ("loh: %d(%Id)->%d(%Id)%s", 
             home_hp->heap_number, dd_new_allocation (home_hp->dynamic_data_of (max_generation + 1)),
-            max_hp->heap_number, dd_new_allocation (max_hp->dynamic_data_of (max_generation + 1))));
+            max_hp->heap_number, dd_new_allocation (max_hp->dynamic_data_of (max_generation + 1)),
+            (remote_node_p ? " remote" : "")));
     }
 
     return max_hp;
@@ -14577,6 +14892,11 @@ BOOL gc_heap::allocate_more_space(alloc_context* acontext, size_t size,
             }
         }
 #else
+        if (alloc_generation_number == 0)
+        {
+            // balance_heaps does this for server GC.
+            acontext->alloc_count++;
+        }
         status = try_allocate_more_space (acontext, size, flags, alloc_generation_number);
 #endif //MULTIPLE_HEAPS
     }
@@ -14668,11 +14988,62 @@ void gc_heap::print_free_and_plug (const char* msg)
             }
         }
     }
+
+    for (int i = max_generation; i <= (max_generation + 1); i++)
+    {
+        generation* gen = generation_of (i);
+        allocator* gen_allocator = generation_allocator (gen);
+        for (unsigned int b = 0; b < gen_allocator->number_of_buckets(); b++)
+        {
+            size_t hits = gen->gen_free_list_bucket_hits[b];
+            size_t misses = gen->gen_free_list_bucket_misses[b];
+            if ((hits + misses) != 0)
+            {
+                dprintf (2, ("[%s][h%d][%s#%d]gen%d FL bucket %d: H: %Id, M: %Id (%d%%)", 
+                    msg, 
+                    heap_number, 
+                    (settings.concurrent ? "BGC" : "GC"),
+                    settings.gc_index,
+                    i, b, hits, misses,
+                    (int)(hits * 100 / (hits + misses))));
+            }
+        }
+    }
 #else
     UNREFERENCED_PARAMETER(msg);
 #endif //FREE_USAGE_STATS && SIMPLE_DPRINTF
 }
 
+// The gen2 counts are for the free list allocations this GC made when planning,
+// the LOH ones for the LOH allocations since the previous GC. Both start over
+// once they are reported.
+void gc_heap::report_free_list_bucket_stats()
+{
+    for (int i = max_generation; i <= (max_generation + 1); i++)
+    {
+        generation* gen = generation_of (i);
+
+#ifdef FEATURE_EVENT_TRACE
+        if (EVENT_ENABLED(GCFreeListBucketStats))
+        {
+            uint32_t num_buckets = (uint32_t)generation_allocator (gen)->number_of_buckets();
+            uint64_t counts[MAX_BUCKET_COUNT * 2];
+            for (uint32_t b = 0; b < num_buckets; b++)
+            {
+                counts[b] = (uint64_t)gen->gen_free_list_bucket_hits[b];
+                counts[num_buckets + b] = (uint64_t)gen->gen_free_list_bucket_misses[b];
+            }
+
+            FIRE_EVENT(GCFreeListBucketStats, (uint32_t)heap_number, (uint32_t)i,
+                       gc_event::uint64_array { counts, num_buckets * 2 });
+        }
+#endif //FEATURE_EVENT_TRACE
+
+        memset (gen->gen_free_list_bucket_hits, 0, sizeof (gen->gen_free_list_bucket_hits));
+        memset (gen->gen_free_list_bucket_misses, 0, sizeof (gen->gen_free_list_bucket_misses));
+    }
+}
+
 void gc_heap::add_gen_plug (int gen_number, size_t plug_size)
 {
 #ifdef FREE_USAGE_STATS
@@ -14794,51 +15165,52 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
     if (! (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, generation_allocation_pointer (gen),
                        generation_allocation_limit (gen), old_loc, USE_PADDING_TAIL | pad_in_front)))
     {
-        size_t sz_list = gen_allocator->first_bucket_size();
-        for (unsigned int a_l_idx = 0; a_l_idx < gen_allocator->number_of_buckets(); a_l_idx++)
+        // We start with the first bucket where every item fits (ie, whose smallest
+        // items are bigger than real_size) so we don't need to walk items that are
+        // too small.
+        for (unsigned int a_l_idx = gen_allocator->first_suitable_bucket (real_size * 2); 
+             a_l_idx < gen_allocator->number_of_buckets(); a_l_idx++)
         {
-            if ((real_size < (sz_list / 2)) || (a_l_idx == (gen_allocator->number_of_buckets()-1)))
+            uint8_t* free_list = gen_allocator->alloc_list_head_of (a_l_idx);
+            uint8_t* prev_free_item = 0;
+            while (free_list != 0)
             {
-                uint8_t* free_list = gen_allocator->alloc_list_head_of (a_l_idx);
-                uint8_t* prev_free_item = 0;
-                while (free_list != 0)
-                {
-                    dprintf (3, ("considering free list %Ix", (size_t)free_list));
+                dprintf (3, ("considering free list %Ix", (size_t)free_list));
 
-                    size_t free_list_size = unused_array_size (free_list);
+                size_t free_list_size = unused_array_size (free_list);
 
-                    if (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, free_list, (free_list + free_list_size),
-                                    old_loc, USE_PADDING_TAIL | pad_in_front))
-                    {
-                        dprintf (4, ("F:%Ix-%Id",
-                                     (size_t)free_list, free_list_size));
+                if (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, free_list, (free_list + free_list_size),
+                                old_loc, USE_PADDING_TAIL | pad_in_front))
+                {
+                    dprintf (4, ("F:%Ix-%Id",
+                                 (size_t)free_list, free_list_size));
+                    gen->gen_free_list_bucket_hits[a_l_idx]++;
 
-                        gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, !discard_p);
-                        generation_free_list_space (gen) -= free_list_size;
-                        remove_gen_free (gen->gen_num, free_list_size);
+                    gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, !discard_p);
+                    generation_free_list_space (gen) -= free_list_size;
+                    remove_gen_free (gen->gen_num, free_list_size);
 
-                        adjust_limit (free_list, free_list_size, gen, from_gen_number+1);
-                        generation_allocate_end_seg_p (gen) = FALSE;
-                        goto finished;
-                    }
-                    // We do first fit on bucket 0 because we are not guaranteed to find a fit there.
-                    else if (discard_p || (a_l_idx == 0))
-                    {
-                        dprintf (3, ("couldn't use this free area, discarding"));
-                        generation_free_obj_space (gen) += free_list_size;
+                    adjust_limit (free_list, free_list_size, gen, from_gen_number+1);
+                    generation_allocate_end_seg_p (gen) = FALSE;
+                    goto finished;
+                }
+                gen->gen_free_list_bucket_misses[a_l_idx]++;
+                // We do first fit on bucket 0 because we are not guaranteed to find a fit there.
+                if (discard_p || (a_l_idx == 0))
+                {
+                    dprintf (3, ("couldn't use this free area, discarding"));
+                    generation_free_obj_space (gen) += free_list_size;
 
-                        gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
-                        generation_free_list_space (gen) -= free_list_size;
-                        remove_gen_free (gen->gen_num, free_list_size);
-                    }
-                    else
-                    {
-                        prev_free_item = free_list;
-                    }
-                    free_list = free_list_slot (free_list); 
+                    gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
+                    generation_free_list_space (gen) -= free_list_size;
+                    remove_gen_free (gen->gen_num, free_list_size);
                 }
+                else
+                {
+                    prev_free_item = free_list;
+                }
+                free_list = free_list_slot (free_list); 
             }
-            sz_list = sz_list * 2;
         }
         //go back to the beginning of the segment list 
         heap_segment* seg = heap_segment_rw (generation_start_segment (gen));
@@ -16365,8 +16737,18 @@ int gc_heap::generation_to_condemn (int n_initial,
                     // a background GC and we'd have to wait for the background GC to finish to start
                     // a blocking collection (right now the implemenation doesn't handle converting 
                     // a background GC to a blocking collection midway.
-                    dprintf (GTC_LOG, ("h%d: bgc - BLOCK", heap_number));
-                    *blocking_collection_p = TRUE;
+                    //
+                    // If the user asked us to avoid the pause of a compacting gen2 we only do that
+                    // when the memory load is very high and let a BGC free up space otherwise.
+                    if (high_frag_blocking_gen2_p || v_high_memory_load)
+                    {
+                        dprintf (GTC_LOG, ("h%d: bgc - BLOCK", heap_number));
+                        *blocking_collection_p = TRUE;
+                    }
+                    else
+                    {
+                        dprintf (GTC_LOG, ("h%d: high frag - BGC", heap_number));
+                    }
                 }
 #else
                 if (v_high_memory_load)
@@ -16914,10 +17296,11 @@ void gc_heap::gc1()
         //decide on the next allocation quantum
         if (alloc_contexts_used >= 1)
         {
-            allocation_quantum = Align (min ((size_t)CLR_SIZE,
-                                            (size_t)max (1024, get_new_allocation (0) / (2 * alloc_contexts_used))),
+            max_allocation_quantum = Align ((size_t)max (1024, get_new_allocation (0) / (2 * alloc_contexts_used)),
                                             get_alignment_constant(FALSE));
-            dprintf (3, ("New allocation quantum: %d(0x%Ix)", allocation_quantum, allocation_quantum));
+            allocation_quantum = min ((size_t)CLR_SIZE, max_allocation_quantum);
+            dprintf (3, ("New allocation quantum: %d(0x%Ix), max %Id", allocation_quantum, allocation_quantum,
+                max_allocation_quantum));
         }
     }
 
@@ -17054,6 +17437,22 @@ void gc_heap::gc1()
     }
 #endif // defined(VERIFY_HEAP) || (defined(FEATURE_EVENT_TRACE) && defined(BACKGROUND_GC))
 
+#ifdef VERIFY_HEAP
+    if (heap_verify_sample_objects && !settings.concurrent
+#ifdef BACKGROUND_GC
+        && !recursive_gc_sync::background_running_p()
+#endif //BACKGROUND_GC
+        )
+    {
+        verify_heap_sampled();
+    }
+#endif //VERIFY_HEAP
+
+    if (gen0_prezero_p && !settings.concurrent)
+    {
+        prezero_gen0_space();
+    }
+
 #ifdef MULTIPLE_HEAPS
     if (!settings.concurrent)
     {
@@ -17062,6 +17461,11 @@ void gc_heap::gc1()
         {
             gc_heap::internal_gc_done = false;
 
+            if (dynamic_heap_count_p)
+            {
+                adjust_dynamic_heap_count();
+            }
+
             //equalize the new desired size of the generations
             int limit = settings.condemned_generation;
             if (limit == max_generation)
@@ -17071,8 +17475,10 @@ void gc_heap::gc1()
             for (int gen = 0; gen <= limit; gen++)
             {
                 size_t total_desired = 0;
+                // We only allocate on the active heaps in gen0 so only their budgets count.
+                int num_heaps_to_equalize = ((gen == 0) ? n_active_heaps : gc_heap::n_heaps);
 
-                for (int i = 0; i < gc_heap::n_heaps; i++)
+                for (int i = 0; i < num_heaps_to_equalize; i++)
                 {
                     gc_heap* hp = gc_heap::g_heaps[i];
                     dynamic_data* dd = hp->dynamic_data_of (gen);
@@ -17086,7 +17492,7 @@ void gc_heap::gc1()
                     total_desired = temp_total_desired;
                 }
 
-                size_t desired_per_heap = Align (total_desired/gc_heap::n_heaps,
+                size_t desired_per_heap = Align (total_desired/num_heaps_to_equalize,
                                                     get_alignment_constant ((gen != (max_generation+1))));
 
                 if (gen == 0)
@@ -17140,13 +17546,14 @@ void gc_heap::gc1()
                 {
                     gc_heap* hp = gc_heap::g_heaps[i];
                     dynamic_data* dd = hp->dynamic_data_of (gen);
-                    dd_desired_allocation (dd) = desired_per_heap;
-                    dd_gc_new_allocation (dd) = desired_per_heap;
-                    dd_new_allocation (dd) = desired_per_heap;
+                    size_t heap_desired = ((i < num_heaps_to_equalize) ? desired_per_heap : dd_min_size (dd));
+                    dd_desired_allocation (dd) = heap_desired;
+                    dd_gc_new_allocation (dd) = heap_desired;
+                    dd_new_allocation (dd) = heap_desired;
 
                     if (gen == 0)
                     {
-                        hp->fgn_last_alloc = desired_per_heap;
+                        hp->fgn_last_alloc = heap_desired;
                     }
                 }
             }
@@ -17167,6 +17574,14 @@ void gc_heap::gc1()
                 max_gen0_must_clear_bricks = max(max_gen0_must_clear_bricks, hp->gen0_must_clear_bricks);
             }
 
+            if (should_trim_free_space())
+            {
+                for (int i = 0; i < gc_heap::n_heaps; i++)
+                {
+                    gc_heap::g_heaps[i]->trim_free_space();
+                }
+            }
+
 #ifdef FEATURE_LOH_COMPACTION
             check_loh_compact_mode (all_heaps_compacted_p);
 #endif //FEATURE_LOH_COMPACTION
@@ -17204,6 +17619,12 @@ void gc_heap::gc1()
     if (!(settings.concurrent))
     {
         rearrange_large_heap_segments();
+
+        if (should_trim_free_space())
+        {
+            trim_free_space();
+        }
+
         do_post_gc();
     }
 
@@ -17908,6 +18329,9 @@ void gc_heap::init_records()
     // we can't simply call memset here. 
     memset (&gc_data_per_heap, 0, sizeof (gc_data_per_heap));
     gc_data_per_heap.heap_index = heap_number;
+#ifdef MULTIPLE_HEAPS
+    gc_data_per_heap.loh_alloc_remote_node_count = (size_t)Interlocked::Exchange (&loh_alloc_remote_node_count, 0);
+#endif //MULTIPLE_HEAPS
     if (heap_number == 0)
         memset (&gc_data_global, 0, sizeof (gc_data_global));
 
@@ -18156,6 +18580,18 @@ void gc_heap::garbage_collect (int n)
         }
 #endif //BACKGROUND_GC
 
+#ifdef FEATURE_LOH_COMPACTION
+        // LOH compaction needs a blocking gen2 - we only piggyback on one that was
+        // already decided on instead of making a BGC blocking for it.
+        if ((settings.condemned_generation == max_generation) &&
+            !settings.concurrent &&
+            !settings.loh_compaction &&
+            loh_compaction_frag_p())
+        {
+            settings.loh_compaction = TRUE;
+        }
+#endif //FEATURE_LOH_COMPACTION
+
         settings.gc_index = (uint32_t)dd_collection_count (dynamic_data_of (0)) + 1;
 
 #ifdef MULTIPLE_HEAPS
@@ -19068,6 +19504,23 @@ inline void Prefetch (void* addr)
     UNREFERENCED_PARAMETER(addr);
 }
 #endif //PREFETCH
+
+// Unlike Prefetch above this always issues the hint. The mark loops use it to get the loads of all of an
+// object's children in flight before gc_mark/background_mark dereference them one at a time; a prefetch of
+// a null or out of range reference is harmless.
+inline void PrefetchForMark (uint8_t* addr)
+{
+#if defined(_MSC_VER) && (defined(_TARGET_AMD64_) || defined(_TARGET_X86_))
+    _mm_prefetch ((const char*)addr, _MM_HINT_T0);
+#elif defined(_MSC_VER) && defined(_TARGET_ARM64_)
+    __prefetch (addr);
+#elif defined(__GNUC__)
+    __builtin_prefetch (addr);
+#else
+    UNREFERENCED_PARAMETER(addr);
+#endif
+}
+
 #ifdef MH_SC_MARK
 inline
 VOLATILE(uint8_t*)& gc_heap::ref_mark_stack (gc_heap* hp, int index)
@@ -19167,6 +19620,12 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                 {
                     dprintf(3,("pushing mark for %Ix ", (size_t)oo));
 
+                    go_through_object_cl (method_table(oo), oo, s, ppslot,
+                                          {
+                                              PrefetchForMark (*ppslot);
+                                          }
+                        );
+
                     go_through_object_cl (method_table(oo), oo, s, ppslot,
                                           {
                                               uint8_t* o = *ppslot;
@@ -19794,6 +20253,12 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
                 {
                     dprintf(3,("pushing mark for %Ix ", (size_t)oo));
 
+                    go_through_object_cl (method_table(oo), oo, s, ppslot,
+                    {
+                        PrefetchForMark (*ppslot);
+                    }
+                        );
+
                     go_through_object_cl (method_table(oo), oo, s, ppslot,
                     {
                         uint8_t* o = *ppslot;
@@ -21045,11 +21510,12 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 #ifdef MULTIPLE_HEAPS
 
 #ifdef MH_SC_MARK
-        if (full_p)
+        if ((mark_steal_mode == mark_steal_all_gcs) ||
+            ((mark_steal_mode == mark_steal_full_gc) && full_p))
         {
             size_t total_heap_size = get_total_heap_size();
 
-            if (total_heap_size > (100 * 1024 * 1024))
+            if (total_heap_size > mark_steal_threshold)
             {
                 do_mark_steal_p = TRUE;
             }
@@ -21062,6 +21528,8 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
         {
             do_mark_steal_p = FALSE;
         }
+
+        dprintf (3, ("gen%d: mark steal %s", condemned_gen_number, (do_mark_steal_p ? "on" : "off")));
 #endif //MH_SC_MARK
 
         gc_t_join.restart();
@@ -21255,6 +21723,9 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     GCScan::GcDhInitialScan(GCHeap::Promote, condemned_gen_number, max_generation, &sc);
     scan_dependent_handles(condemned_gen_number, &sc, true);
 
+    fire_mark_event (heap_number, ETW::GC_ROOT_DH_HANDLES, (promoted_bytes (heap_number) - last_promoted_bytes));
+    last_promoted_bytes = promoted_bytes (heap_number);
+
 #ifdef MULTIPLE_HEAPS
     dprintf(3, ("Joining for short weak handle scan"));
     gc_t_join.join(this, gc_join_null_dead_short_weak);
@@ -22417,6 +22888,37 @@ BOOL gc_heap::loh_compaction_requested()
     return (loh_compaction_always_p || (loh_compaction_mode != loh_compaction_default));
 }
 
+BOOL gc_heap::loh_compaction_frag_p()
+{
+    if (loh_compaction_frag_percent == 0)
+    {
+        return FALSE;
+    }
+
+    size_t loh_frag = get_total_gen_fragmentation (max_generation + 1);
+    size_t loh_size = 0;
+#ifdef MULTIPLE_HEAPS
+    for (int i = 0; i < gc_heap::n_heaps; i++)
+    {
+        gc_heap* hp = gc_heap::g_heaps[i];
+#else //MULTIPLE_HEAPS
+    {
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+        loh_size += hp->generation_size (max_generation + 1);
+    }
+
+    // Unless the free space adds up to at least a segment, compacting can't
+    // give any memory back and isn't worth the cost of moving the objects.
+    BOOL frag_p = ((loh_frag >= min_loh_segment_size) &&
+                   ((loh_frag * 100) >= (loh_size * loh_compaction_frag_percent)));
+
+    dprintf (GTC_LOG, ("loh frag: %Id of %Id, threshold %d%%, compact: %d",
+        loh_frag, loh_size, loh_compaction_frag_percent, frag_p));
+
+    return frag_p;
+}
+
 inline
 void gc_heap::check_loh_compact_mode (BOOL all_heaps_compacted_p)
 {
@@ -22584,7 +23086,7 @@ BOOL gc_heap::plan_loh()
 
 void gc_heap::compact_loh()
 {
-    assert (loh_compaction_requested() || heap_hard_limit);
+    assert (loh_compaction_requested() || heap_hard_limit || (loh_compaction_frag_percent != 0));
 
     generation* gen        = large_object_generation;
     heap_segment* start_seg = heap_segment_rw (generation_start_segment (gen));
@@ -22930,6 +23432,104 @@ void gc_heap::record_interesting_data_point (interesting_data_point idp)
 #endif //GC_CONFIG_DRIVEN
 }
 
+#ifdef FEATURE_EVENT_TRACE
+// The table and the event rows are only allocated the first time the event is
+// enabled and never freed - it's a few hundred KB per heap.
+void gc_heap::init_type_survival()
+{
+    type_survival_p = false;
+
+    if (!EVENT_ENABLED(GCTypeSurvival))
+    {
+        return;
+    }
+
+    if (!type_survival_table)
+    {
+        if (!type_survival_rows)
+        {
+            type_survival_rows = new (nothrow) uint64_t [TYPE_SURVIVAL_ROWS_PER_EVENT * TYPE_SURVIVAL_ROW_FIELDS];
+            if (!type_survival_rows)
+            {
+                return;
+            }
+        }
+
+        type_survival_table = new (nothrow) type_survival_entry [TYPE_SURVIVAL_TABLE_SIZE];
+        if (!type_survival_table)
+        {
+            return;
+        }
+        memset (type_survival_table, 0, sizeof (type_survival_entry) * TYPE_SURVIVAL_TABLE_SIZE);
+    }
+
+    type_survival_p = true;
+}
+
+void gc_heap::record_type_survival (uint8_t* o, size_t s)
+{
+    MethodTable* mt = (MethodTable*)method_table (o);
+    const size_t max_probes = 16;
+    // The last entry is for the types we don't have room for.
+    const size_t num_buckets = TYPE_SURVIVAL_TABLE_SIZE - 1;
+    size_t index = (((size_t)mt >> 3) * 2654435761u) % num_buckets;
+    type_survival_entry* entry = &type_survival_table[num_buckets];
+
+    for (size_t i = 0; i < max_probes; i++)
+    {
+        type_survival_entry* curr_entry = &type_survival_table[(index + i) % num_buckets];
+        if ((curr_entry->mt == mt) || (curr_entry->mt == 0))
+        {
+            curr_entry->mt = mt;
+            entry = curr_entry;
+            break;
+        }
+    }
+
+    int gen_number = object_gennum (o);
+    entry->survived_size[gen_number] += s;
+    entry->survived_count[gen_number]++;
+}
+
+// Rows are batched so a GC fires a handful of events instead of one per type,
+// which keeps down the time spent with the EE suspended.
+void gc_heap::fire_type_survival_events()
+{
+    uint32_t row_count = 0;
+
+    for (size_t i = 0; i < TYPE_SURVIVAL_TABLE_SIZE; i++)
+    {
+        type_survival_entry* entry = &type_survival_table[i];
+        for (int gen_number = 0; gen_number <= max_generation; gen_number++)
+        {
+            if (entry->survived_count[gen_number])
+            {
+                uint64_t* row = &type_survival_rows[row_count * TYPE_SURVIVAL_ROW_FIELDS];
+                row[0] = (uint64_t)(size_t)entry->mt;
+                row[1] = (uint64_t)gen_number;
+                row[2] = (uint64_t)entry->survived_size[gen_number];
+                row[3] = (uint64_t)entry->survived_count[gen_number];
+
+                if (++row_count == TYPE_SURVIVAL_ROWS_PER_EVENT)
+                {
+                    FIRE_EVENT(GCTypeSurvival, (uint32_t)heap_number,
+                               gc_event::uint64_array { type_survival_rows, row_count * TYPE_SURVIVAL_ROW_FIELDS });
+                    row_count = 0;
+                }
+            }
+        }
+    }
+
+    if (row_count)
+    {
+        FIRE_EVENT(GCTypeSurvival, (uint32_t)heap_number,
+                   gc_event::uint64_array { type_survival_rows, row_count * TYPE_SURVIVAL_ROW_FIELDS });
+    }
+
+    memset (type_survival_table, 0, sizeof (type_survival_entry) * TYPE_SURVIVAL_TABLE_SIZE);
+}
+#endif //FEATURE_EVENT_TRACE
+
 #ifdef _PREFAST_
 #pragma warning(push)
 #pragma warning(disable:21000) // Suppress PREFast warning about overly large function
@@ -22959,6 +23559,10 @@ void gc_heap::plan_phase (int condemned_gen_number)
 
     generation*  condemned_gen1 = generation_of (condemned_gen_number);
 
+#ifdef FEATURE_EVENT_TRACE
+    init_type_survival();
+#endif //FEATURE_EVENT_TRACE
+
 #ifdef MARK_LIST
     BOOL use_mark_list = FALSE;
     uint8_t** mark_list_next = &mark_list[0];
@@ -23355,6 +23959,13 @@ void gc_heap::plan_phase (int condemned_gen_number)
                     assert ((size (xl) > 0));
                     assert ((size (xl) <= loh_size_threshold));
 
+#ifdef FEATURE_EVENT_TRACE
+                    if (type_survival_p)
+                    {
+                        record_type_survival (xl, Align (size (xl)));
+                    }
+#endif //FEATURE_EVENT_TRACE
+
                     last_object_in_plug = xl;
 
                     xl = xl + Align (size (xl));
@@ -23794,6 +24405,7 @@ void gc_heap::plan_phase (int condemned_gen_number)
 
     plan_generation_starts (consing_gen);
     print_free_and_plug ("AP");
+    report_free_list_bucket_stats();
 
     {
 #ifdef SIMPLE_DPRINTF
@@ -23991,6 +24603,14 @@ void gc_heap::plan_phase (int condemned_gen_number)
         settings.loh_compaction = FALSE;
     }
 
+#ifdef FEATURE_EVENT_TRACE
+    if (type_survival_p)
+    {
+        fire_type_survival_events();
+        type_survival_p = false;
+    }
+#endif //FEATURE_EVENT_TRACE
+
 #ifdef MULTIPLE_HEAPS
 
     new_heap_segment = NULL;
@@ -30096,6 +30716,31 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+// Returns the first card word in [card_word, card_word_end[ that has any card set,
+// or card_word_end if there isn't one. Card words are tested 4 at a time (a 16 byte
+// chunk) so sparse card tables don't cost a test and a branch per card word.
+inline
+uint32_t* find_set_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+    const size_t chunk_card_words = 4;
+
+    while ((size_t)(card_word_end - card_word) >= chunk_card_words)
+    {
+        if ((card_word[0] | card_word[1] | card_word[2] | card_word[3]) != 0)
+        {
+            break;
+        }
+        card_word += chunk_card_words;
+    }
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+
+    return card_word;
+}
+
 #ifdef CARD_BUNDLE
 
 // Find the first non-zero card word between cardw and cardw_end.
@@ -30121,10 +30766,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_set_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -30150,15 +30792,11 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         uint32_t* card_word = &card_table[cardw];
         uint32_t* card_word_end = &card_table [cardw_end];
 
-        while (card_word < card_word_end)
+        card_word = find_set_card_word (card_word, card_word_end);
+        if (card_word != card_word_end)
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -30211,12 +30849,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_set_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -30233,11 +30866,10 @@ BOOL gc_heap::find_card(uint32_t* card_table,
     // Look for the lowest bit set
     if (card_word_value)
     {
-        while (!(card_word_value & 1))
-        {
-            bit_position++;
-            card_word_value = card_word_value / 2;
-        }
+        DWORD lowest_set_bit;
+        BitScanForward (&lowest_set_bit, card_word_value);
+        bit_position += lowest_set_bit;
+        card_word_value >>= lowest_set_bit;
     }
     
     // card is the card word index * card size + the bit index within the card
@@ -32440,6 +33072,7 @@ bool gc_heap::init_dynamic_data()
         dd->gc_new_allocation = dd->new_allocation;
         dd->desired_allocation = dd->new_allocation;
         dd->fragmentation = 0;
+        dd->gc_speed = 0;
     }
 
 #ifdef GC_CONFIG_DRIVEN
@@ -32596,6 +33229,22 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
             new_allocation = linear_allocation_model (allocation_fraction, new_allocation, 
                                                       dd_desired_allocation (dd), dd_collection_count (dd));
 
+            if (pause_goal_ms && (dd_gc_speed (dd) > 0.0f) && (cst > 0.0f))
+            {
+                // The next GC of this generation will need to mark and copy roughly
+                // new_allocation * cst bytes; keep that under what we can do within
+                // the pause goal at the speed we measured for previous GCs.
+                size_t pause_goal_allocation = (size_t)min ((double)max_size, 
+                    (double)pause_goal_ms * dd_gc_speed (dd) / cst);
+                if (new_allocation > pause_goal_allocation)
+                {
+                    dprintf (GTC_LOG, ("h%d gen%d: reducing new alloc %Id->%Id for pause goal %Idms (%d bytes/ms, surv %d%%)",
+                        heap_number, gen_number, new_allocation, max (pause_goal_allocation, min_gc_size),
+                        pause_goal_ms, (int)dd_gc_speed (dd), (int)(cst * 100)));
+                    new_allocation = max (pause_goal_allocation, min_gc_size);
+                }
+            }
+
             if (gen_number == 0)
             {
                 if (pass == 0)
@@ -32836,6 +33485,36 @@ gc_history_per_heap* gc_heap::get_gc_data_per_heap()
 #endif //BACKGROUND_GC
 }
 
+// Records how many bytes per ms an ephemeral GC that condemned gen_number
+// marked and copied on this heap. This is smoothed over GCs since the pause
+// of a single GC can be skewed by things like waiting for threads to suspend.
+void gc_heap::update_gc_speed (int gen_number)
+{
+    dynamic_data* dd = dynamic_data_of (gen_number);
+
+    size_t survived = 0;
+    for (int i = 0; i <= gen_number; i++)
+    {
+        survived += dd_survived_size (dynamic_data_of (i));
+    }
+
+    // The elapsed time is in ms and ephemeral GCs often take less than 1ms.
+    float current_speed = (float)survived / (float)max (dd_gc_elapsed_time (dd), (size_t)1);
+
+    if (dd_gc_speed (dd) == 0.0f)
+    {
+        dd_gc_speed (dd) = current_speed;
+    }
+    else
+    {
+        dd_gc_speed (dd) = (dd_gc_speed (dd) * 3.0f + current_speed) / 4.0f;
+    }
+
+    dprintf (GTC_LOG, ("h%d gen%d GC: survived %Id in %Idms, speed %d->%d bytes/ms",
+        heap_number, gen_number, survived, dd_gc_elapsed_time (dd), 
+        (int)current_speed, (int)dd_gc_speed (dd)));
+}
+
 void gc_heap::compute_new_dynamic_data (int gen_number)
 {
     PREFIX_ASSUME(gen_number >= 0);
@@ -32859,6 +33538,11 @@ void gc_heap::compute_new_dynamic_data (int gen_number)
     gen_data->free_list_space_after = generation_free_list_space (gen);
     gen_data->free_obj_space_after = generation_free_obj_space (gen);
 
+    if ((gen_number == settings.condemned_generation) && (gen_number < max_generation))
+    {
+        update_gc_speed (gen_number);
+    }
+
     if ((settings.pause_mode == pause_low_latency) && (gen_number <= 1))
     {
         // When we are in the low latency mode, we can still be
@@ -32977,6 +33661,121 @@ void gc_heap::trim_youngest_desired_low_memory()
     }
 }
 
+// Clears the space after alloc_allocated that gen0 will allocate in next
+// if it's dirty from before this GC. This is done by each heap's GC thread
+// so under Server GC it's done in parallel. We only do this if the dirty
+// part fits in the gen0 budget - otherwise most of it is going to get
+// decommitted anyway.
+void gc_heap::prezero_gen0_space()
+{
+    heap_segment* seg = ephemeral_heap_segment;
+    uint8_t* clear_start = alloc_allocated - plug_skew;
+    uint8_t* used = heap_segment_used (seg);
+
+    if (used <= clear_start)
+        return;
+
+    size_t clear_size = (size_t)(used - clear_start);
+    if (clear_size > dd_desired_allocation (dynamic_data_of (0)))
+    {
+        dprintf (3, ("h%d: not pre-zeroing %Id dirty bytes after %Ix", heap_number, clear_size, (size_t)clear_start));
+        return;
+    }
+
+    dprintf (3, ("h%d: pre-zeroing [%Ix, %Ix[", heap_number, (size_t)clear_start, (size_t)used));
+    memclr (clear_start, clear_size);
+    heap_segment_used (seg) = clear_start;
+}
+
+// Called once per GC (on heap 0 for server GC) after the budgets are computed.
+// We only trim in blocking GCs that checked the memory load (gen1 and up) when
+// there's no BGC in progress, since we walk the LOH free list.
+bool gc_heap::should_trim_free_space()
+{
+    if (!trim_on_high_memory_load_p || use_large_pages_p || settings.concurrent)
+    {
+        return false;
+    }
+
+#ifdef BACKGROUND_GC
+    if (recursive_gc_sync::background_running_p())
+    {
+        return false;
+    }
+#endif //BACKGROUND_GC
+
+    if ((settings.condemned_generation < (max_generation - 1)) ||
+        (settings.entry_memory_load < high_memory_load_th))
+    {
+        return false;
+    }
+
+    uint64_t now = GetHighPrecisionTimeStamp();
+    uint64_t timeout = (g_low_memory_status ? 0 : GC_TRIM_FREE_SPACE_TIMEOUT);
+    if ((now - last_trim_free_space_time) < timeout)
+    {
+        return false;
+    }
+
+    last_trim_free_space_time = now;
+    trim_free_space_count++;
+    return true;
+}
+
+void gc_heap::trim_free_space()
+{
+    size_t decommitted = 0;
+    size_t reset = 0;
+
+    // Unlike decommit_heap_segment_pages we don't keep any slack at the end of
+    // the segments - when memory is tight we'd rather commit it again later.
+    for (int gen_number = max_generation; gen_number <= (max_generation + 1); gen_number++)
+    {
+        heap_segment* seg = heap_segment_rw (generation_start_segment (generation_of (gen_number)));
+        while (seg)
+        {
+            if ((seg != ephemeral_heap_segment) && !heap_segment_read_only_p (seg))
+            {
+                uint8_t* page_start = align_on_page (heap_segment_allocated (seg));
+                if (page_start < heap_segment_committed (seg))
+                {
+                    size_t size = heap_segment_committed (seg) - page_start;
+                    virtual_decommit (page_start, size, heap_number);
+                    heap_segment_committed (seg) = page_start;
+                    if (heap_segment_used (seg) > heap_segment_committed (seg))
+                    {
+                        heap_segment_used (seg) = heap_segment_committed (seg);
+                    }
+                    decommitted += size;
+                }
+            }
+            seg = heap_segment_next_rw (seg);
+        }
+    }
+
+    // gen2 free spaces are already reset when they are threaded (see thread_gap)
+    // but the LOH ones are not. Allocating out of a free list item clears it so
+    // it's fine for the OS to discard its content.
+    allocator* loh_allocator = generation_allocator (generation_of (max_generation + 1));
+    for (unsigned int bucket = 0; bucket < loh_allocator->number_of_buckets(); bucket++)
+    {
+        uint8_t* free_item = loh_allocator->alloc_list_head_of (bucket);
+        while (free_item)
+        {
+            size_t free_size = unused_array_size (free_item);
+            reset += reset_memory (free_item, free_size);
+            free_item = free_list_slot (free_item);
+        }
+    }
+
+    trim_free_space_decommitted += decommitted;
+    trim_free_space_reset += reset;
+
+    dprintf (GTC_LOG, ("h%d: ml %d, trimmed: decommitted %Id, reset %Id (total %Id/%Id in %Id trims)",
+        heap_number, settings.entry_memory_load, decommitted, reset,
+        trim_free_space_decommitted, trim_free_space_reset, trim_free_space_count));
+}
+
 void gc_heap::decommit_ephemeral_segment_pages()
 {
     if (settings.concurrent)
@@ -33284,6 +34083,23 @@ BOOL gc_heap::decide_on_compacting (int condemned_gen_number,
             }
         }
 #endif // BIT64
+
+        // When asked to conserve memory we compact gen2 as soon as compacting would give back more than
+        // (10 - setting)/10 of it, e.g. 1/2 of gen2 for setting 5 and 1/10 for setting 9.
+        if (!should_compact && (condemned_gen_number == max_generation) && (conserve_mem_setting != 0))
+        {
+            size_t gen2_size = generation_size (max_generation);
+            ptrdiff_t gen2_reclaim_space = gen2_size - generation_plan_size (max_generation);
+
+            if ((gen2_reclaim_space > 0) &&
+                (((size_t)gen2_reclaim_space * 10) > (gen2_size * (10 - conserve_mem_setting))))
+            {
+                dprintf (GTC_LOG, ("compacting due to conserve memory setting %d, reclaim %Id of %Id",
+                    conserve_mem_setting, gen2_reclaim_space, gen2_size));
+                should_compact = TRUE;
+                get_gc_data_per_heap()->set_mechanism (gc_heap_compact, compact_conserve_mem);
+            }
+        }
     }
 
     // The purpose of calling ensure_gap_allocation here is to make sure
@@ -33631,8 +34447,11 @@ CObjectHeader* gc_heap::allocate_large_object (size_t jsize, uint32_t flags, int
     return obj;
 }
 
-void reset_memory (uint8_t* o, size_t sizeo)
+// Returns the number of bytes that were actually reset.
+size_t reset_memory (uint8_t* o, size_t sizeo)
 {
+    size_t reset_size = 0;
+
     if (sizeo > 128 * 1024)
     {
         // We cannot reset the memory for the useful part of a free object.
@@ -33653,8 +34472,14 @@ void reset_memory (uint8_t* o, size_t sizeo)
 #endif //MULTIPLE_HEAPS
 
             reset_mm_p = GCToOSInterface::VirtualReset((void*)page_start, size, unlock_p);
+            if (reset_mm_p)
+            {
+                reset_size = size;
+            }
         }
     }
+
+    return reset_size;
 }
 
 BOOL gc_heap::large_object_marked (uint8_t* o, BOOL clearp)
@@ -34302,7 +35127,11 @@ void gc_heap::background_sweep()
 #ifdef FEATURE_EVENT_TRACE
         bgc_heap_walk_for_etw_p = GCEventStatus::IsEnabled(GCEventProvider_Default, 
                                                            GCEventKeyword_GCHeapSurvivalAndMovement, 
-                                                           GCEventLevel_Information);
+                                                           GCEventLevel_Information) ||
+                                  (GCEventStatus::IsEnabled(GCEventProvider_Default, 
+                                                            GCEventKeyword_GCHeapDump, 
+                                                            GCEventLevel_Information) &&
+                                   GCToEEInterface::DiagBackgroundHeapDumpRequested());
 #endif //FEATURE_EVENT_TRACE
 
         leave_spin_lock (&gc_lock);
@@ -36358,6 +37187,178 @@ gc_heap::verify_heap (BOOL begin_gc_p)
 #endif //BACKGROUND_GC 
 }
 
+// Same as gc_rand::get_rand (r) but on this heap's own state.
+uint64_t gc_heap::get_verify_sample_rand (uint64_t r)
+{
+    verify_sample_rand_state = (314159269 * verify_sample_rand_state + 278281) & 0x7FFFFFFF;
+    return ((verify_sample_rand_state * r) >> 31);
+}
+
+// A much cheaper version of verify_heap that's meant to be used in production -
+// it verifies a window of up to heap_verify_sample_objects objects starting at a
+// random brick of a random gen2/LOH segment (gen0 is not covered): the object
+// sizes, method tables, the brick chain we used to find the window and the cards
+// for ephemeral references. This is only called after blocking GCs when there's
+// no BGC in progress and doesn't need to join with other heaps.
+void gc_heap::verify_heap_sampled()
+{
+    size_t num_segs = 0;
+    for (int gen_number = max_generation; gen_number <= (max_generation + 1); gen_number++)
+    {
+        heap_segment* seg = heap_segment_in_range (generation_start_segment (generation_of (gen_number)));
+        while (seg)
+        {
+            num_segs++;
+            seg = heap_segment_next_in_range (seg);
+        }
+    }
+
+    size_t seg_index = (size_t)get_verify_sample_rand (num_segs);
+    heap_segment* seg = 0;
+    BOOL loh_p = FALSE;
+    for (int gen_number = max_generation; (gen_number <= (max_generation + 1)) && !seg; gen_number++)
+    {
+        heap_segment* curr_seg = heap_segment_in_range (generation_start_segment (generation_of (gen_number)));
+        while (curr_seg)
+        {
+            if (seg_index == 0)
+            {
+                seg = curr_seg;
+                loh_p = (gen_number == (max_generation + 1));
+                break;
+            }
+            seg_index--;
+            curr_seg = heap_segment_next_in_range (curr_seg);
+        }
+    }
+
+    if (!seg || heap_segment_read_only_p (seg))
+    {
+        return;
+    }
+
+    uint8_t* start = heap_segment_mem (seg);
+    uint8_t* end = ((seg == ephemeral_heap_segment) ?
+                    generation_allocation_start (generation_of (0)) :
+                    heap_segment_allocated (seg));
+    if (start >= end)
+    {
+        return;
+    }
+
+    uint8_t* o = start;
+    if (!loh_p)
+    {
+        // Find the window through the brick table the same way card marking does.
+        ptrdiff_t min_brick = (ptrdiff_t)brick_of (start);
+        ptrdiff_t curr_brick = min_brick + (ptrdiff_t)get_verify_sample_rand (brick_of (end - 1) - min_brick + 1);
+        while (curr_brick >= min_brick)
+        {
+            short brick_entry = brick_table[curr_brick];
+            if (brick_entry > 0)
+            {
+                o = brick_address (curr_brick) + brick_entry - 1;
+                break;
+            }
+
+            if (brick_entry == 0)
+            {
+                // Not necessarily a corruption, just start at the beginning of the segment.
+                break;
+            }
+
+            curr_brick += brick_entry;
+        }
+
+        if ((o < start) || (o >= end))
+        {
+            dprintf (1, ("h%d: sampled verify: brick %Ix points to %Ix outside of [%Ix, %Ix[",
+                heap_number, curr_brick, (size_t)o, (size_t)start, (size_t)end));
+            FATAL_GC_ERROR();
+        }
+    }
+    else
+    {
+        // The LOH doesn't use the brick table, but its objects are big so there are few
+        // of them - walk from the beginning of the segment to a random brick's worth of it.
+        ptrdiff_t min_brick = (ptrdiff_t)brick_of (start);
+        uint8_t* target = brick_address (min_brick + (ptrdiff_t)get_verify_sample_rand (brick_of (end - 1) - min_brick + 1));
+        int loh_align_const = get_alignment_constant (FALSE);
+        while (o < end)
+        {
+            size_t s = size (o);
+            uint8_t* next_o = o + Align (s, loh_align_const);
+            if ((s == 0) || (next_o <= o) || (next_o > end))
+            {
+                dprintf (1, ("h%d: sampled verify: object %Ix in seg %Ix has a bad size %Id",
+                    heap_number, (size_t)o, (size_t)seg, s));
+                FATAL_GC_ERROR();
+            }
+
+            if (next_o > target)
+            {
+                break;
+            }
+
+            o = next_o;
+        }
+    }
+
+    // In server GC the card table could be updated by another heap - only check
+    // the cards if ours is the one the write barrier uses.
+    BOOL check_cards_p = (card_table == g_gc_card_table);
+    uint8_t* gen1_start = generation_allocation_start (generation_of (max_generation - 1));
+    int align_const = get_alignment_constant (!loh_p);
+    size_t objects_verified = 0;
+
+    dprintf (2, ("h%d: sampled verify of seg %Ix from %Ix", heap_number, (size_t)seg, (size_t)o));
+
+    while ((o < end) && (objects_verified < heap_verify_sample_objects))
+    {
+        size_t s = size (o);
+        uint8_t* next_o = o + Align (s, align_const);
+        if ((s == 0) || (next_o <= o) || (next_o > heap_segment_allocated (seg)))
+        {
+            dprintf (1, ("h%d: sampled verify: object %Ix in seg %Ix has a bad size %Id",
+                heap_number, (size_t)o, (size_t)seg, s));
+            FATAL_GC_ERROR();
+        }
+
+        if (method_table (o) != g_gc_pFreeObjectMethodTable)
+        {
+            ((CObjectHeader*)o)->ValidateHeap((Object*)o, FALSE);
+
+            if (check_cards_p && contain_pointers (o))
+            {
+                // Same check as verify_heap - a card set anywhere before the reference
+                // in the object is good enough.
+                uint8_t* next_boundary = (((seg == ephemeral_heap_segment) && (o >= gen1_start)) ?
+                                          generation_allocation_start (generation_of (0)) :
+                                          gen1_start);
+                size_t crd = card_of (o);
+                BOOL found_card_p = card_set_p (crd);
+                go_through_object_nostart (method_table(o), o, s, oo,
+                {
+                    if ((crd != card_of ((uint8_t*)oo)) && !found_card_p)
+                    {
+                        crd = card_of ((uint8_t*)oo);
+                        found_card_p = card_set_p (crd);
+                    }
+                    if ((*oo < ephemeral_high) && (*oo >= next_boundary) && !found_card_p)
+                    {
+                        dprintf (1, ("h%d: sampled verify: card not set for %Ix in object %Ix pointing to %Ix",
+                            heap_number, (size_t)oo, (size_t)o, (size_t)*oo));
+                        FATAL_GC_ERROR();
+                    }
+                });
+            }
+        }
+
+        objects_verified++;
+        o = next_o;
+    }
+}
+
 #endif  //VERIFY_HEAP
 
 
@@ -36624,6 +37625,10 @@ HRESULT GCHeap::Initialize()
     }
     else
     {
+        // Only change the alignment we reserve with if the OS can actually back
+        // the ranges with transparent large pages.
+        gc_heap::use_transparent_large_pages_p = GCConfig::GetGCLargePages() &&
+            GCToOSInterface::CanUseTransparentLargePages();
         seg_size = get_valid_segment_size();
         gc_heap::soh_segment_size = seg_size;
         large_seg_size = get_valid_segment_size (TRUE);
@@ -36685,6 +37690,12 @@ HRESULT GCHeap::Initialize()
 
     gc_heap::m_high_memory_load_th = min ((gc_heap::high_memory_load_th + 5), gc_heap::v_high_memory_load_th);
 
+    int conserve_mem_from_config = (int)GCConfig::GetGCConserveMem();
+    if ((conserve_mem_from_config >= 0) && (conserve_mem_from_config <= 9))
+    {
+        gc_heap::conserve_mem_setting = conserve_mem_from_config;
+    }
+
     gc_heap::pm_stress_on = (GCConfig::GetGCProvModeStress() != 0);
 
 #if defined(BIT64) 
@@ -37637,6 +38648,9 @@ GCHeap::FixAllocContext (gc_alloc_context* context, void* arg, void *heap)
     gc_heap* hp = gc_heap::heap_of (alloc_ptr);
 #else
     gc_heap* hp = pGenGCHeap;
+
+    if (arg != 0)
+        acontext->alloc_count = 0;
 #endif //MULTIPLE_HEAPS
 
     if (heap == NULL || heap == hp)
@@ -37974,7 +38988,12 @@ void gc_heap::record_interesting_info_per_heap()
 
     int compact_reason = get_gc_data_per_heap()->get_mechanism (gc_heap_compact);
     if (compact_reason >= 0)
-        (compact_reasons_per_heap[compact_reason])++;
+    {
+        if (compact_reason < max_dac_compact_reasons_count)
+            (compact_reasons_per_heap[compact_reason])++;
+        else if (compact_reason == compact_conserve_mem)
+            compact_conserve_mem_count++;
+    }
     int expand_mechanism = get_gc_data_per_heap()->get_mechanism (gc_heap_expand);
     if (expand_mechanism >= 0)
         (expand_mechanisms_per_heap[expand_mechanism])++;
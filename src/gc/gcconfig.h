@@ -86,16 +86,36 @@ public:
     BOOL_CONFIG(GCNumaAware,   "GCNumaAware", true, "Enables numa allocations in the GC")        \
     BOOL_CONFIG(GCCpuGroup,    "GCCpuGroup", false, "Enables CPU groups in the GC")              \
     BOOL_CONFIG(GCLargePages,  "GCLargePages", false, "Enables using Large Pages in the GC")     \
+    BOOL_CONFIG(HighFragBlockingGen2, "GCHighFragBlockingGen2", true,                            \
+        "When set to false, a gen2 triggered by fragmentation is only a blocking compacting GC "  \
+        "if the memory load is very high, otherwise it is done as a background GC")              \
     INT_CONFIG(HeapVerifyLevel, "HeapVerify", HEAPVERIFY_NONE,                                   \
         "When set verifies the integrity of the managed heap on entry and exit of each GC")      \
+    INT_CONFIG(HeapVerifySampleObjects, "GCHeapVerifySample", 0,                                 \
+        "If non zero, verifies up to this many objects from a random spot of each heap "         \
+        "after each blocking GC")                                                                \
     INT_CONFIG(LOHCompactionMode, "GCLOHCompact", 0, "Specifies the LOH compaction mode")        \
+    INT_CONFIG(LOHCompactionFragPercent, "GCLOHCompactionFragPercent", 0,                        \
+        "If non zero, a blocking gen2 GC also compacts the LOH when this percentage of the LOH " \
+        "is free space")                                                                         \
     INT_CONFIG(LOHThreshold, "GCLOHThreshold", LARGE_OBJECT_SIZE,                                \
         "Specifies the size that will make objects go on LOH")                                   \
+    INT_CONFIG(GCLOHRemoteNodeImbalance, "GCLOHRemoteNodeImbalance", 150,                        \
+        "Specifies how much more LOH budget, in percent of the LOH min budget, a heap on another"\
+        " NUMA node needs before Server GC balances an LOH allocation to it, from 0 to 10000")   \
     INT_CONFIG(BGCSpinCount,  "BGCSpinCount", 140, "Specifies the bgc spin count")               \
     INT_CONFIG(BGCSpin,       "BGCSpin",      2,   "Specifies the bgc spin time")                \
     INT_CONFIG(HeapCount,     "GCHeapCount",  0,   "Specifies the number of server GC heaps")    \
+    BOOL_CONFIG(DynamicHeapCount, "GCDynamicHeapCount", false,                                   \
+        "Specifies whether Server GC adjusts how many heaps are allocated on based on GC overhead")\
+    INT_CONFIG(DynamicHeapCountGCPercent, "GCDynamicHeapCountGCPercent", 5,                      \
+        "Specifies the percent of time spent in blocking GCs above which Server GC allocates on "\
+        "more heaps when GCDynamicHeapCount is enabled")                                         \
     INT_CONFIG(Gen0Size,      "GCgen0size",   0, "Specifies the smallest gen0 size")             \
     INT_CONFIG(SegmentSize,   "GCSegmentSize", 0, "Specifies the managed heap segment size")     \
+    INT_CONFIG(RegionSize,    "GCRegionSize", 0,                                                 \
+        "Specifies the size of the regions the ephemeral segment is committed and decommitted "  \
+        "in. 0 means use the default page based policy")                                         \
     INT_CONFIG(LatencyMode,   "GCLatencyMode", -1,                                               \
         "Specifies the GC latency mode - batch, interactive or low latency (note that the same " \
         "thing can be specified via API which is the supported way")                             \
@@ -105,6 +125,11 @@ public:
     INT_CONFIG(LogFileSize,   "GCLogFileSize", 0, "Specifies the GC log file size")              \
     INT_CONFIG(CompactRatio,  "GCCompactRatio", 0,                                               \
         "Specifies the ratio compacting GCs vs sweeping")                                        \
+    INT_CONFIG(GCMarkStealMode, "GCMarkStealMode", 1,                                            \
+        "Specifies which GCs let Server GC heaps steal mark work from each other - 0 none, 1 full "\
+        "blocking GCs, 2 all blocking GCs")                                                      \
+    INT_CONFIG(GCMarkStealThreshold, "GCMarkStealThreshold", (100 * 1024 * 1024),                \
+        "Specifies the total heap size above which Server GC heaps steal mark work")             \
     INT_CONFIG(GCHeapAffinitizeMask, "GCHeapAffinitizeMask", 0,                                  \
         "Specifies processor mask for Server GC threads")                                        \
     STRING_CONFIG(GCHeapAffinitizeRanges, "GCHeapAffinitizeRanges",                              \
@@ -113,10 +138,24 @@ public:
         "prefixed by the CPU group number. Example: Unix - 1,3,5,7-9,12, Windows - 0:1,1:7-9")   \
     INT_CONFIG(GCHighMemPercent, "GCHighMemPercent", 0,                                          \
         "The percent for GC to consider as high memory")                                         \
+    INT_CONFIG(GCConserveMem, "GCConserveMemory", 0,                                             \
+        "Specifies how hard GC should try to conserve memory - values 0-9, 0 means disabled")   \
     INT_CONFIG(GCProvModeStress, "GCProvModeStress", 0,                                          \
         "Stress the provisional modes")                                                          \
     INT_CONFIG(GCGen0MaxBudget, "GCGen0MaxBudget", 0,                                            \
         "Specifies the largest gen0 allocation budget")                                          \
+    BOOL_CONFIG(GCGen0PreZero, "GCGen0PreZero", false,                                           \
+        "Specifies whether the GC clears the gen0 space that will be allocated in next before "  \
+        "the mutator resumes, so allocating threads don't have to")                              \
+    BOOL_CONFIG(GCAdaptiveAllocQuantum, "GCAdaptiveAllocQuantum", false,                         \
+        "Specifies whether threads that allocate a lot get bigger allocation quantums")          \
+    BOOL_CONFIG(GCTrimOnHighMemoryLoad, "GCTrimOnHighMemoryLoad", false,                         \
+        "Specifies whether blocking GCs give free gen2 and LOH space back to the OS when the "   \
+        "memory load is high")                                                                   \
+    INT_CONFIG(GCAllocationTickKB, "GCAllocationTickKB", 0,                                      \
+        "Specifies the amount allocated in KB between GCAllocationTick events, 0 means 100KB")   \
+    INT_CONFIG(GCPauseGoalMs, "GCPauseGoalMs", 0,                                                \
+        "Specifies a pause goal in ms that limits the gen0 and gen1 budgets, 0 means no goal")   \
     INT_CONFIG(GCHeapHardLimit, "GCHeapHardLimit", 0,                                            \
         "Specifies a hard limit for the GC heap")                                                \
     INT_CONFIG(GCHeapHardLimitPercent, "GCHeapHardLimitPercent", 0,                              \
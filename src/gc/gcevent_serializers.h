@@ -98,6 +98,53 @@ struct EventSerializationTraits<uint32_t>
     }
 };
 
+template<>
+struct EventSerializationTraits<uint64_t>
+{
+    static void Serialize(const uint64_t& value, uint8_t** buffer)
+    {
+#if defined(BIGENDIAN)
+        **((uint64_t**)buffer) = ByteSwap64(value);
+#else
+        **((uint64_t**)buffer) = value;
+#endif // BIGENDIAN
+        *buffer += sizeof(uint64_t);
+    }
+
+    static size_t SerializedSize(const uint64_t& value)
+    {
+        return sizeof(uint64_t);
+    }
+};
+
+/*
+ * A counted array of uint64_t, serialized as a uint32_t element count followed
+ * by the elements. This lets one event carry many records.
+ */
+struct uint64_array
+{
+    const uint64_t* data;
+    uint32_t count;
+};
+
+template<>
+struct EventSerializationTraits<uint64_array>
+{
+    static void Serialize(const uint64_array& value, uint8_t** buffer)
+    {
+        EventSerializationTraits<uint32_t>::Serialize(value.count, buffer);
+        for (uint32_t i = 0; i < value.count; i++)
+        {
+            EventSerializationTraits<uint64_t>::Serialize(value.data[i], buffer);
+        }
+    }
+
+    static size_t SerializedSize(const uint64_array& value)
+    {
+        return sizeof(uint32_t) + (value.count * sizeof(uint64_t));
+    }
+};
+
 /*
  * Helper routines for serializing lists of arguments.
  */
@@ -26,6 +26,12 @@ KNOWN_EVENT(GCAllocationTick_V3, GCEventProvider_Default, GCEventLevel_Verbose,
 KNOWN_EVENT(PinObjectAtGCTime, GCEventProvider_Default, GCEventLevel_Verbose, GCEventKeyword_GC)
 KNOWN_EVENT(GCPerHeapHistory_V3, GCEventProvider_Default, GCEventLevel_Information, GCEventKeyword_GC)
 
+// heap number, generation, then the hits of each free list bucket followed by the misses of each bucket
+DYNAMIC_EVENT(GCFreeListBucketStats, GCEventLevel_Verbose, GCEventKeyword_GC, uint32_t, uint32_t, gc_event::uint64_array)
+
+// heap number, then rows of type (MethodTable), generation the objects survived from, survived bytes, survived object count
+DYNAMIC_EVENT(GCTypeSurvival, GCEventLevel_Verbose, GCEventKeyword_GCHeapSurvivalAndMovement, uint32_t, gc_event::uint64_array)
+
 KNOWN_EVENT(SetGCHandle, GCEventProvider_Default, GCEventLevel_Information, GCEventKeyword_GCHandle)
 KNOWN_EVENT(DestroyGCHandle, GCEventProvider_Default, GCEventLevel_Information, GCEventKeyword_GCHandle)
 
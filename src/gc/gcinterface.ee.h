@@ -418,6 +418,11 @@ public:
 
     virtual
     void UpdateGCEventStatus(int publicLevel, int publicKeywords, int privateLEvel, int privateKeywords) = 0;
+
+    // Returns true if the diagnostics code has asked for a heap dump to be
+    // taken at the end of the next background GC.
+    virtual
+    bool DiagBackgroundHeapDumpRequested() = 0;
 };
 
 #endif // _GCINTERFACE_EE_H_
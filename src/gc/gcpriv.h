@@ -400,6 +400,17 @@ enum gc_loh_compaction_mode
     loh_compaction_auto = 4 // GC decides when to compact LOH, to be implemented.
 };
 
+#ifdef MH_SC_MARK
+// Specifies which GCs let server GC heaps steal work from each other's mark stacks
+// (see GCMarkStealMode).
+enum gc_mark_steal_mode
+{
+    mark_steal_never = 0,
+    mark_steal_full_gc = 1, // the default mode, only for full blocking GCs.
+    mark_steal_all_gcs = 2  // for ephemeral GCs as well.
+};
+#endif //MH_SC_MARK
+
 enum set_pause_mode_status
 {
     set_pause_mode_success = 0,
@@ -717,6 +728,10 @@ public:
     }
     unsigned int number_of_buckets() {return (unsigned int)num_buckets;}
 
+    // Returns the first bucket whose items could be big enough for size, ie,
+    // the bucket thread_item would put an item of this size on.
+    unsigned int first_suitable_bucket (size_t size);
+
     size_t first_bucket_size() {return frst_bucket_size;}
     uint8_t*& alloc_list_head_of (unsigned int bn)
     {
@@ -795,6 +810,12 @@ public:
     size_t          pinned_allocation_sweep_size;
     int             gen_num;
 
+    // how many free list allocations were satisfied from each bucket and how many
+    // free items we looked at in each bucket that didn't fit. Only kept for gen2
+    // and LOH, see report_free_list_bucket_stats.
+    size_t          gen_free_list_bucket_hits[MAX_BUCKET_COUNT];
+    size_t          gen_free_list_bucket_misses[MAX_BUCKET_COUNT];
+
 #ifdef FREE_USAGE_STATS
     size_t          gen_free_spaces[NUM_GEN_POWER2];
     // these are non pinned plugs only
@@ -1109,6 +1130,26 @@ enum interesting_data_point
     max_idp_count
 };
 
+#ifdef FEATURE_EVENT_TRACE
+// What survived of a type in a GC, per generation it survived from. Recorded in
+// plan_phase when the GCTypeSurvival event is enabled.
+struct type_survival_entry
+{
+    MethodTable* mt;
+    size_t survived_size[max_generation + 1];
+    size_t survived_count[max_generation + 1];
+};
+
+// Number of entries in the per heap table, types that don't fit are recorded in
+// an entry with no type.
+#define TYPE_SURVIVAL_TABLE_SIZE 4096
+
+// Each GCTypeSurvival event carries up to this many rows of (type, generation,
+// survived bytes, survived object count), which keeps an event under 64KB.
+#define TYPE_SURVIVAL_ROWS_PER_EVENT 1024
+#define TYPE_SURVIVAL_ROW_FIELDS 4
+#endif //FEATURE_EVENT_TRACE
+
 //class definition of the internal class
 class gc_heap
 {
@@ -1205,6 +1246,14 @@ public:
     void verify_free_lists(); 
     PER_HEAP
     void verify_heap (BOOL begin_gc_p);
+    PER_HEAP
+    void verify_heap_sampled();
+    PER_HEAP
+    uint64_t get_verify_sample_rand (uint64_t r);
+
+    // See GCHeapVerifySample.
+    PER_HEAP_ISOLATED
+    size_t heap_verify_sample_objects;
 #endif //VERIFY_HEAP
 
     PER_HEAP_ISOLATED
@@ -1266,6 +1315,12 @@ public:
     PER_HEAP_ISOLATED
     void hb_log_balance_activities();
 
+    PER_HEAP_ISOLATED
+    int get_active_heap_no (int hp_num);
+
+    PER_HEAP_ISOLATED
+    void adjust_dynamic_heap_count();
+
     static
     void balance_heaps (alloc_context* acontext);
     PER_HEAP
@@ -1499,9 +1554,11 @@ protected:
     PER_HEAP
     void fire_etw_pin_object_event (uint8_t* object, uint8_t** ppObject);
 
+    PER_HEAP
+    size_t get_allocation_quantum (alloc_context* acontext);
     PER_HEAP
     size_t limit_from_size (size_t size, uint32_t flags, size_t room, int gen_number,
-                            int align_const);
+                            int align_const, alloc_context* acontext);
     PER_HEAP
     allocation_state try_allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags, 
                                               int alloc_generation_number);
@@ -1925,6 +1982,9 @@ protected:
     PER_HEAP
     void print_free_and_plug (const char* msg);
 
+    PER_HEAP
+    void report_free_list_bucket_stats();
+
     PER_HEAP
     void add_gen_plug (int gen_number, size_t plug_size);
 
@@ -2492,6 +2552,15 @@ protected:
     PER_HEAP
     void plan_phase (int condemned_gen_number);
 
+#ifdef FEATURE_EVENT_TRACE
+    PER_HEAP
+    void init_type_survival();
+    PER_HEAP
+    void record_type_survival (uint8_t* o, size_t s);
+    PER_HEAP
+    void fire_type_survival_events();
+#endif //FEATURE_EVENT_TRACE
+
     PER_HEAP
     void record_interesting_data_point (interesting_data_point idp);
 
@@ -2549,6 +2618,11 @@ protected:
     PER_HEAP_ISOLATED
     BOOL loh_compaction_requested();
 
+    // Decides whether a blocking gen2 should also compact the LOH because
+    // of how fragmented it has become.
+    PER_HEAP_ISOLATED
+    BOOL loh_compaction_frag_p();
+
     // If the LOH compaction mode is just to compact once,
     // we need to see if we should reset it back to not compact.
     // We would only reset if every heap's LOH was compacted.
@@ -2851,6 +2925,12 @@ protected:
 
     PER_HEAP
     void decommit_ephemeral_segment_pages();
+    PER_HEAP
+    void prezero_gen0_space();
+    PER_HEAP_ISOLATED
+    bool should_trim_free_space();
+    PER_HEAP
+    void trim_free_space();
 
 #ifdef BIT64
     PER_HEAP_ISOLATED
@@ -2910,6 +2990,8 @@ protected:
     PER_HEAP
     size_t  compute_in (int gen_number);
     PER_HEAP
+    void update_gc_speed (int gen_number);
+    PER_HEAP
     void compute_new_dynamic_data (int gen_number);
     PER_HEAP
     gc_history_per_heap* get_gc_data_per_heap();
@@ -3181,7 +3263,7 @@ public:
     size_t interesting_data_per_heap[max_idp_count];
 
     PER_HEAP
-    size_t compact_reasons_per_heap[max_compact_reasons_count];
+    size_t compact_reasons_per_heap[max_dac_compact_reasons_count];
 
     PER_HEAP
     size_t expand_mechanisms_per_heap[max_expand_mechanisms_count];
@@ -3204,6 +3286,18 @@ public:
 
     // End DAC zone
 
+#ifdef VERIFY_HEAP
+    // Random state for picking the GCHeapVerifySample window. Server GC heaps sample
+    // at the same time so each heap has its own, seeded from its heap number.
+    PER_HEAP
+    uint64_t verify_sample_rand_state;
+#endif //VERIFY_HEAP
+
+    // GCs that compacted for compact_conserve_mem, which doesn't fit in
+    // compact_reasons_per_heap.
+    PER_HEAP
+    size_t compact_conserve_mem_count;
+
 #define max_oom_history_count 4
 
     PER_HEAP
@@ -3334,6 +3428,24 @@ public:
     PER_HEAP
     size_t etw_allocation_running_amount[2];
 
+    // Amount allocated on a heap (SOH and LOH separately) between allocation
+    // tick events, see GCAllocationTickKB.
+    PER_HEAP_ISOLATED
+    size_t etw_allocation_tick;
+
+#ifdef FEATURE_EVENT_TRACE
+    PER_HEAP
+    type_survival_entry* type_survival_table;
+
+    // Staging buffer for the rows of one GCTypeSurvival event.
+    PER_HEAP
+    uint64_t* type_survival_rows;
+
+    // True if this GC records type survival in plan_phase.
+    PER_HEAP
+    bool type_survival_p;
+#endif //FEATURE_EVENT_TRACE
+
     PER_HEAP
     uint64_t total_alloc_bytes_soh;
 
@@ -3419,6 +3531,11 @@ public:
     PER_HEAP_ISOLATED
     uint32_t v_high_memory_load_th;
 
+    // 0 means we don't trade CPU for memory; 1-9 make gen2 GCs compact at
+    // increasingly lower fragmentation.
+    PER_HEAP_ISOLATED
+    int conserve_mem_setting;
+
     PER_HEAP_ISOLATED
     uint64_t mem_one_percent;
 
@@ -3487,6 +3604,39 @@ public:
     PER_HEAP_ISOLATED
     size_t heap_hard_limit;
 
+    // If non zero, gen0 and gen1 budgets are capped so the predicted pause of
+    // the next ephemeral GC, based on the measured gc speed, stays under this.
+    PER_HEAP_ISOLATED
+    size_t pause_goal_ms;
+
+    // If true, blocking GCs clear the dirty gen0 space after alloc_allocated
+    // so allocating threads don't need to clear it (see GCGen0PreZero).
+    PER_HEAP_ISOLATED
+    bool gen0_prezero_p;
+
+    // If true, blocking GCs under high memory load decommit the space at the
+    // end of gen2/LOH segments and reset LOH free list items, at most once
+    // every GC_TRIM_FREE_SPACE_TIMEOUT ms (see GCTrimOnHighMemoryLoad).
+    PER_HEAP_ISOLATED
+    bool trim_on_high_memory_load_p;
+
+    // See get_allocation_quantum.
+    PER_HEAP_ISOLATED
+    bool adaptive_allocation_quantum_p;
+
+    PER_HEAP_ISOLATED
+    uint64_t last_trim_free_space_time;
+
+    // How many times we trimmed and how much we decommitted/reset doing so.
+    PER_HEAP_ISOLATED
+    size_t trim_free_space_count;
+
+    PER_HEAP_ISOLATED
+    size_t trim_free_space_decommitted;
+
+    PER_HEAP_ISOLATED
+    size_t trim_free_space_reset;
+
     PER_HEAP_ISOLATED
     CLRCriticalSection check_commit_cs;
 
@@ -3505,6 +3655,12 @@ public:
     PER_HEAP_ISOLATED
     bool use_large_pages_p;
 
+    // This is if we asked for large pages without a hard limit - we then
+    // can't commit everything upfront so we ask the OS to back our
+    // reservations with large pages as they get committed.
+    PER_HEAP_ISOLATED
+    bool use_transparent_large_pages_p;
+
     PER_HEAP_ISOLATED
     size_t last_gc_index;
 
@@ -3553,6 +3709,39 @@ protected:
     int heap_number;
     PER_HEAP
     VOLATILE(int) alloc_context_count;
+
+    // Number of LOH allocations from threads whose home heap is this heap that
+    // were balanced to a heap on a different NUMA node since the last GC.
+    PER_HEAP
+    VOLATILE(int32_t) loh_alloc_remote_node_count;
+
+    // How much more LOH budget (in percent of the LOH min size) a heap on a
+    // remote NUMA node needs to have before we balance an LOH allocation to it.
+    PER_HEAP_ISOLATED
+    int loh_remote_node_imbalance_percent;
+
+    // Number of heaps that allocation contexts are balanced to; heaps
+    // [n_active_heaps, n_heaps) still get collected but are not allocated on
+    // and only get the min gen0 budget. This is n_heaps unless
+    // GCDynamicHeapCount is enabled.
+    PER_HEAP_ISOLATED
+    int n_active_heaps;
+
+    PER_HEAP_ISOLATED
+    bool dynamic_heap_count_p;
+
+    PER_HEAP_ISOLATED
+    size_t dynamic_heap_count_gc_percent;
+
+    // Accumulated blocking GC time and GC count since dhc_sample_start_time.
+    PER_HEAP_ISOLATED
+    size_t dhc_sample_start_time;
+
+    PER_HEAP_ISOLATED
+    size_t dhc_sample_gc_elapsed_time;
+
+    PER_HEAP_ISOLATED
+    size_t dhc_sample_gc_count;
 #else //MULTIPLE_HEAPS
 #define vm_heap ((GCHeap*) g_theGCHeap)
 #define heap_number (0)
@@ -3616,6 +3805,11 @@ protected:
     PER_HEAP_ISOLATED
     gc_loh_compaction_mode loh_compaction_mode;
 
+    // This is for automatic LOH compaction based on fragmentation via the
+    // complus env var - 0 means disabled.
+    PER_HEAP_ISOLATED
+    uint32_t    loh_compaction_frag_percent;
+
     // We may not compact LOH on every heap if we can't
     // grow the pinned queue. This is to indicate whether
     // this heap's LOH is compacted or not. So even if
@@ -3682,6 +3876,11 @@ protected:
     PER_HEAP_ISOLATED
     bool temp_disable_concurrent_p;
 
+    // If false, a gen2 that was elevated for fragmentation under high (but not
+    // very high) memory load is done as a BGC instead of a blocking compacting GC.
+    PER_HEAP_ISOLATED
+    bool high_frag_blocking_gen2_p;
+
     PER_HEAP_ISOLATED
     BOOL do_ephemeral_gc_p;
 
@@ -3890,6 +4089,11 @@ protected:
     PER_HEAP
     size_t allocation_quantum;
 
+    // The share of the gen0 budget per allocation context - with
+    // GCAdaptiveAllocQuantum busy threads get quantums up to this.
+    PER_HEAP
+    size_t max_allocation_quantum;
+
     PER_HEAP
     size_t alloc_contexts_used;
 
@@ -4262,6 +4466,13 @@ public:
 #ifdef MH_SC_MARK
     PER_HEAP_ISOLATED
     int*  g_mark_stack_busy;
+
+    PER_HEAP_ISOLATED
+    gc_mark_steal_mode mark_steal_mode;
+
+    // total heap size above which we steal mark work.
+    PER_HEAP_ISOLATED
+    size_t mark_steal_threshold;
 #endif //MH_SC_MARK
 #else
     static
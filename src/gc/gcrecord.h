@@ -236,9 +236,14 @@ enum gc_heap_compact_reason
     compact_high_mem_frag = 8, 
     compact_vhigh_mem_frag = 9,
     compact_no_gc_mode = 10,
-    max_compact_reasons_count = 11
+    compact_conserve_mem = 11,
+    max_compact_reasons_count = 12
 };
 
+// The DAC and SOS read compact_reasons_per_heap with room for the reasons up to
+// compact_no_gc_mode only, so the ones added after it are counted separately.
+#define max_dac_compact_reasons_count (compact_no_gc_mode + 1)
+
 #ifndef DACCESS_COMPILE
 static BOOL gc_heap_compact_reason_mandatory_p[] =
 {
@@ -252,7 +257,8 @@ static BOOL gc_heap_compact_reason_mandatory_p[] =
     FALSE, //compact_high_mem_load = 7, 
     TRUE, //compact_high_mem_frag = 8, 
     TRUE, //compact_vhigh_mem_frag = 9,
-    TRUE //compact_no_gc_mode = 10
+    TRUE, //compact_no_gc_mode = 10,
+    TRUE //compact_conserve_mem = 11
 };
 
 static BOOL gc_expand_mechanism_mandatory_p[] =
@@ -279,7 +285,8 @@ static char* str_heap_compact_reasons[] =
     "high memory load (ephemeral GC)",
     "high memory load and frag",
     "very high memory load and frag",
-    "no gc mode"
+    "no gc mode",
+    "conserve memory"
 };
 #endif //DT_LOG
 
@@ -345,6 +352,10 @@ public:
 
     size_t extra_gen0_committed;
 
+    // LOH allocations from this heap's threads that were balanced to a heap on
+    // another NUMA node since the previous GC.
+    size_t loh_alloc_remote_node_count;
+
     void set_mechanism (gc_mechanism_per_heap mechanism_per_heap, uint32_t value);
 
     void set_mechanism_bit (gc_mechanism_bit_per_heap mech_bit)
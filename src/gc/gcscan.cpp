@@ -58,6 +58,8 @@ void GCScan::GcDhInitialScan(promote_func* fn, int condemned, int max_gen, ScanC
     pDhContext->m_iCondemned = condemned;
     pDhContext->m_iMaxGen = max_gen;
     pDhContext->m_pScanContext = sc;
+    // Handles from a previous GC are stale, the first scan needs to look at the whole table.
+    pDhContext->m_fPendingValid = false;
 
     // Look for dependent handle whose primary has been promoted but whose secondary has not. Promote the
     // secondary in those cases. Additionally this scan sets the m_fUnpromotedPrimaries and m_fPromoted state
@@ -21,14 +21,25 @@
 // result we need to maintain a context between all the DH scanning methods called during a single mark phase.
 // The structure below describes this context. We allocate one of these per GC heap at Ref_Initialize time and
 // select between them based on the ScanContext passed to us by the GC during the mark phase.
+// A dependent handle whose primary was not promoted yet when we last looked at it.
+struct DhPendingHandle
+{
+    Object        **m_pPrimary;                 // Primary object slot of the handle
+    Object        **m_pSecondary;               // Secondary object slot of the handle
+};
+
 struct DhContext
 {
     bool            m_fUnpromotedPrimaries;     // Did last scan find at least one non-null unpromoted primary?
     bool            m_fPromoted;                // Did last scan promote at least one secondary?
+    bool            m_fPendingValid;            // Does m_pPending hold every handle with an unpromoted primary?
     promote_func   *m_pfnPromoteFunction;       // GC promote callback to be used for all secondary promotions
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+    DhPendingHandle *m_pPending;                // Handles re-scans need to look at (if m_fPendingValid)
+    size_t          m_cPending;                 // Number of entries used in m_pPending
+    size_t          m_cPendingCapacity;         // Number of entries allocated in m_pPending
 };
 
 class GCScan
@@ -522,8 +522,8 @@ void HndLogSetEvent(OBJECTHANDLE handle, _UNCHECKED_OBJECTREF value)
         FIRE_EVENT(SetGCHandle, (void *)handle, (void *)value, hndType, generation);
         FIRE_EVENT(PrvSetGCHandle, (void *) handle, (void *)value, hndType, generation);
 
-        // Also fire the things pinned by Async pinned handles
-        if (hndType == HNDTYPE_ASYNCPINNED)
+        // Also fire the things pinned by Async pinned handles. A cleared handle pins nothing.
+        if (hndType == HNDTYPE_ASYNCPINNED && value != nullptr)
         {
             GCToEEInterface::WalkAsyncPinned(value, value, [](Object*, Object* to, void* ctx)
             {
@@ -183,6 +183,38 @@ void CALLBACK UpdateDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pE
 #endif
 }
 
+// Remember a dependent handle with an unpromoted primary so re-scans only need to look at these handles
+// rather than walking the whole table again. If we can't grow the list we stop recording and re-scans walk
+// the table as before.
+static void RecordPendingDependentHandle(DhContext *pDhContext, Object **pPrimaryRef, Object **pSecondaryRef)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pDhContext->m_cPending == pDhContext->m_cPendingCapacity)
+    {
+        size_t cNewCapacity = max((pDhContext->m_cPendingCapacity * 2), (size_t)256);
+        DhPendingHandle *pNewPending = new (nothrow) DhPendingHandle[cNewCapacity];
+        if (pNewPending == NULL)
+        {
+            pDhContext->m_fPendingValid = false;
+            return;
+        }
+
+        if (pDhContext->m_pPending != NULL)
+        {
+            memcpy(pNewPending, pDhContext->m_pPending, (pDhContext->m_cPending * sizeof(DhPendingHandle)));
+            delete [] pDhContext->m_pPending;
+        }
+
+        pDhContext->m_pPending = pNewPending;
+        pDhContext->m_cPendingCapacity = cNewCapacity;
+    }
+
+    DhPendingHandle *pEntry = &pDhContext->m_pPending[pDhContext->m_cPending++];
+    pEntry->m_pPrimary = pPrimaryRef;
+    pEntry->m_pSecondary = pSecondaryRef;
+}
+
 void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t lp1, uintptr_t lp2)
 {
     LIMITED_METHOD_CONTRACT;
@@ -218,6 +250,9 @@ void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *p
         // promoted handles, so there's no chance of finding an additional handle being promoted on a
         // subsequent scan).
         pDhContext->m_fUnpromotedPrimaries = true;
+
+        if (pDhContext->m_fPendingValid)
+            RecordPendingDependentHandle(pDhContext, pPrimaryRef, pSecondaryRef);
     }
 }
     
@@ -639,7 +674,7 @@ bool Ref_Initialize()
 
     // Allocate contexts used during dependent handle promotion scanning. There's one of these for every GC
     // heap since they're scanned in parallel.
-    g_pDependentHandleContexts = new (nothrow) DhContext[n_slots];
+    g_pDependentHandleContexts = new (nothrow) DhContext[n_slots]();
     if (g_pDependentHandleContexts == NULL)
         goto CleanupAndFail;
 
@@ -661,6 +696,10 @@ void Ref_Shutdown()
 
     if (g_pDependentHandleContexts)
     {
+        for (int i = 0; i < getNumberOfSlots(); i++)
+        {
+            delete [] g_pDependentHandleContexts[i].m_pPending;
+        }
         delete [] g_pDependentHandleContexts;
         g_pDependentHandleContexts = NULL;
     }
@@ -1186,12 +1225,47 @@ DhContext *Ref_GetDependentHandleContext(ScanContext* sc)
     return &g_pDependentHandleContexts[getSlotNumber(sc)];
 }
 
+// Re-visit the dependent handles whose primaries were unpromoted as of the last scan, promoting the
+// secondaries of the ones whose primaries are now promoted and dropping those from the list.
+static void ScanPendingDependentHandles(DhContext *pDhContext)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    promote_func* callback = pDhContext->m_pfnPromoteFunction;
+    size_t cRemaining = 0;
+
+    for (size_t i = 0; i < pDhContext->m_cPending; i++)
+    {
+        DhPendingHandle entry = pDhContext->m_pPending[i];
+
+        if (*entry.m_pPrimary && g_theGCHeap->IsPromoted(*entry.m_pPrimary))
+        {
+            if (!g_theGCHeap->IsPromoted(*entry.m_pSecondary))
+            {
+                LOG((LF_GC|LF_ENC, LL_INFO10000, "\tPromoting secondary " LOG_OBJECT_CLASS(*entry.m_pSecondary)));
+                callback(entry.m_pSecondary, pDhContext->m_pScanContext, 0);
+                pDhContext->m_fPromoted = true;
+            }
+        }
+        else if (*entry.m_pPrimary)
+        {
+            pDhContext->m_pPending[cRemaining++] = entry;
+        }
+    }
+
+    pDhContext->m_cPending = cRemaining;
+    pDhContext->m_fUnpromotedPrimaries = (cRemaining != 0);
+}
+
 // Scan the dependent handle table promoting any secondary object whose associated primary object is promoted.
 //
 // Multiple scans may be required since (a) secondary promotions made during one scan could cause the primary
 // of another handle to be promoted and (b) the GC may not have marked all promoted objects at the time it
 // initially calls us.
 //
+// Once a complete scan of the table has been done while the table can't change (i.e. not during a
+// concurrent scan) the handles with unpromoted primaries are known and we only re-visit those.
+//
 // Returns true if any promotions resulted from this scan.
 bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
 {
@@ -1220,28 +1294,39 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
         pDhContext->m_fUnpromotedPrimaries = false;
         pDhContext->m_fPromoted = false;
 
-        HandleTableMap *walk = &g_HandleTableMap;
-        while (walk) 
+        if (pDhContext->m_fPendingValid)
         {
-            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+            ScanPendingDependentHandles(pDhContext);
+        }
+        else
+        {
+            // Record the handles with unpromoted primaries as we go if we can.
+            pDhContext->m_cPending = 0;
+            pDhContext->m_fPendingValid = !pDhContext->m_pScanContext->concurrent;
+
+            HandleTableMap *walk = &g_HandleTableMap;
+            while (walk) 
             {
-                if (walk->pBuckets[i] != NULL)
+                for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
                 {
-                    HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(pDhContext->m_pScanContext)];
-                    if (hTable)
+                    if (walk->pBuckets[i] != NULL)
                     {
-                        HndScanHandlesForGC(hTable,
-                                            PromoteDependentHandle,
-                                            uintptr_t(pDhContext->m_pScanContext),
-                                            uintptr_t(pDhContext->m_pfnPromoteFunction),
-                                            &type, 1,
-                                            pDhContext->m_iCondemned,
-                                            pDhContext->m_iMaxGen,
-                                            flags );
+                        HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(pDhContext->m_pScanContext)];
+                        if (hTable)
+                        {
+                            HndScanHandlesForGC(hTable,
+                                                PromoteDependentHandle,
+                                                uintptr_t(pDhContext->m_pScanContext),
+                                                uintptr_t(pDhContext->m_pfnPromoteFunction),
+                                                &type, 1,
+                                                pDhContext->m_iCondemned,
+                                                pDhContext->m_iMaxGen,
+                                                flags );
+                        }
                     }
                 }
+                walk = walk->pNext;
             }
-            walk = walk->pNext;
         }
 
         if (pDhContext->m_fPromoted)
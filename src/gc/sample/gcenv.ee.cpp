@@ -353,3 +353,8 @@ inline void GCToEEInterface::AnalyzeSurvivorsFinished(int condemnedGeneration)
 {
     
 }
+
+bool GCToEEInterface::DiagBackgroundHeapDumpRequested()
+{
+    return false;
+}
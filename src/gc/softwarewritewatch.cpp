@@ -189,6 +189,24 @@ void SoftwareWriteWatch::GetDirty(
 
         while (currentBlock < fullBlockEnd)
         {
+            // Most of the table is typically clean, skip over clean runs of several blocks at a time so the cost of the
+            // scan is mostly proportional to how much was dirtied rather than to the size of the region
+            static_assert(SkipCleanBlockCount == 4, "Unexpected SkipCleanBlockCount");
+            while (currentBlock + SkipCleanBlockCount * sizeof(size_t) <= fullBlockEnd)
+            {
+                size_t *blocks = reinterpret_cast<size_t *>(currentBlock);
+                if ((blocks[0] | blocks[1] | blocks[2] | blocks[3]) != 0)
+                {
+                    break;
+                }
+                currentBlock += SkipCleanBlockCount * sizeof(size_t);
+                firstPageAddressInCurrentBlock += SkipCleanBlockCount * sizeof(size_t) * WRITE_WATCH_UNIT_SIZE;
+            }
+            if (currentBlock >= fullBlockEnd)
+            {
+                break;
+            }
+
             if (!GetDirtyFromBlock(
                     currentBlock,
                     firstPageAddressInCurrentBlock,
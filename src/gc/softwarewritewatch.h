@@ -32,6 +32,9 @@ private:
     // GetTable()[address >> AddressToTableByteIndexShift] is the byte that represents the region of memory for 'address'.
     static const uint8_t AddressToTableByteIndexShift = SOFTWARE_WRITE_WATCH_AddressToTableByteIndexShift;
 
+    // Number of size_t-sized blocks of the table that GetDirty checks at once when skipping clean parts of the table
+    static const size_t SkipCleanBlockCount = 4;
+
 private:
     static void VerifyCreated();
     static void VerifyMemoryRegion(void *baseAddress, size_t regionByteSize);
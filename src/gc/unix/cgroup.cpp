@@ -23,6 +23,9 @@ Abstract:
 #include <stdio.h>
 #include <string.h>
 #include <sys/resource.h>
+#if defined(__linux__)
+#include <sys/vfs.h>
+#endif
 #include <errno.h>
 #include <limits>
 
@@ -35,20 +38,34 @@ Abstract:
 #define PROC_MOUNTINFO_FILENAME "/proc/self/mountinfo"
 #define PROC_CGROUP_FILENAME "/proc/self/cgroup"
 #define PROC_STATM_FILENAME "/proc/self/statm"
-#define MEM_LIMIT_FILENAME "/memory.limit_in_bytes"
-#define MEM_USAGE_FILENAME "/memory.usage_in_bytes"
-#define CFS_QUOTA_FILENAME "/cpu.cfs_quota_us"
-#define CFS_PERIOD_FILENAME "/cpu.cfs_period_us"
+#define CGROUP1_MEMORY_LIMIT_FILENAME "/memory.limit_in_bytes"
+#define CGROUP2_MEMORY_LIMIT_FILENAME "/memory.max"
+#define CGROUP1_MEMORY_USAGE_FILENAME "/memory.usage_in_bytes"
+#define CGROUP2_MEMORY_USAGE_FILENAME "/memory.current"
+#define CGROUP1_CFS_QUOTA_FILENAME "/cpu.cfs_quota_us"
+#define CGROUP1_CFS_PERIOD_FILENAME "/cpu.cfs_period_us"
+#define CGROUP2_CPU_MAX_FILENAME "/cpu.max"
+#define CGROUP_ROOT_PATH "/sys/fs/cgroup"
+
+#ifndef CGROUP2_SUPER_MAGIC
+#define CGROUP2_SUPER_MAGIC 0x63677270
+#endif
 
 class CGroup
 {
+    // Version of the cgroup hierarchy the limits are read from, 1 or 2
+    static int s_cgroup_version;
+
     static char* s_memory_cgroup_path;
     static char* s_cpu_cgroup_path;
 public:
     static void Initialize()
     {
-        s_memory_cgroup_path = FindCgroupPath(&IsMemorySubsystem);
-        s_cpu_cgroup_path = FindCgroupPath(&IsCpuSubsystem);
+        s_cgroup_version = FindCGroupVersion();
+
+        // cgroup v2 has a single unified hierarchy, so there is no subsystem to look for
+        s_memory_cgroup_path = FindCgroupPath(s_cgroup_version == 2 ? nullptr : &IsMemorySubsystem);
+        s_cpu_cgroup_path = FindCgroupPath(s_cgroup_version == 2 ? nullptr : &IsCpuSubsystem);
     }
 
     static void Cleanup()
@@ -66,13 +83,14 @@ public:
             return result;
 
         size_t len = strlen(s_memory_cgroup_path);
-        len += strlen(MEM_LIMIT_FILENAME);
+        const char *mem_limit_file = (s_cgroup_version == 2) ? CGROUP2_MEMORY_LIMIT_FILENAME : CGROUP1_MEMORY_LIMIT_FILENAME;
+        len += strlen(mem_limit_file);
         mem_limit_filename = (char*)malloc(len+1);
         if (mem_limit_filename == nullptr)
             return result;
 
         strcpy(mem_limit_filename, s_memory_cgroup_path);
-        strcat(mem_limit_filename, MEM_LIMIT_FILENAME);
+        strcat(mem_limit_filename, mem_limit_file);
         result = ReadMemoryValueFromFile(mem_limit_filename, val);
         free(mem_limit_filename);
         return result;
@@ -88,13 +106,14 @@ public:
             return result;
 
         size_t len = strlen(s_memory_cgroup_path);
-        len += strlen(MEM_USAGE_FILENAME);
+        const char *mem_usage_file = (s_cgroup_version == 2) ? CGROUP2_MEMORY_USAGE_FILENAME : CGROUP1_MEMORY_USAGE_FILENAME;
+        len += strlen(mem_usage_file);
         mem_usage_filename = (char*)malloc(len+1);
         if (mem_usage_filename == nullptr)
             return result;
 
         strcpy(mem_usage_filename, s_memory_cgroup_path);
-        strcat(mem_usage_filename, MEM_USAGE_FILENAME);
+        strcat(mem_usage_filename, mem_usage_file);
         result = ReadMemoryValueFromFile(mem_usage_filename, &temp);
         if (result)
         {
@@ -115,31 +134,56 @@ public:
     {
         long long quota;
         long long period;
-        double cpu_count;
 
-        quota = ReadCpuCGroupValue(CFS_QUOTA_FILENAME);
-        if (quota <= 0)
-            return false;
+        if (s_cgroup_version == 2)
+        {
+            if (!ReadCGroup2CpuMax(&quota, &period))
+                return false;
+        }
+        else
+        {
+            quota = ReadCpuCGroupValue(CGROUP1_CFS_QUOTA_FILENAME);
+            if (quota <= 0)
+                return false;
 
-        period = ReadCpuCGroupValue(CFS_PERIOD_FILENAME);
-        if (period <= 0)
-            return false;
+            period = ReadCpuCGroupValue(CGROUP1_CFS_PERIOD_FILENAME);
+            if (period <= 0)
+                return false;
+        }
 
+        ComputeCpuLimit(quota, period, val);
+        return true;
+    }
+
+private:
+    static int FindCGroupVersion()
+    {
+        // Both cgroup v1 and v2 may be mounted on a system. /sys/fs/cgroup is the v2 unified hierarchy itself
+        // only when v2 manages resources; otherwise it is a tmpfs holding the v1 controller mounts (this includes
+        // the "hybrid" layout, where v2 is only mounted under it for process tracking). Anything else keeps the
+        // v1 lookup, which finds no limits when no controllers are mounted.
+#if defined(__linux__)
+        struct statfs stats;
+        if ((statfs(CGROUP_ROOT_PATH, &stats) == 0) && (stats.f_type == CGROUP2_SUPER_MAGIC))
+            return 2;
+#endif
+        return 1;
+    }
+
+    static void ComputeCpuLimit(long long quota, long long period, uint32_t *val)
+    {
         // Cannot have less than 1 CPU
         if (quota <= period)
         {
             *val = 1;
-            return true;
+            return;
         }
 
         // Calculate cpu count based on quota and round it up
-        cpu_count = (double) quota / period  + 0.999999999;
+        double cpu_count = (double) quota / period  + 0.999999999;
         *val = (cpu_count < UINT32_MAX) ? (uint32_t)cpu_count : UINT32_MAX;
-
-        return true;
     }
-    
-private:
+
     static bool IsMemorySubsystem(const char *strTok){
         return strcmp("memory", strTok) == 0;
     }
@@ -220,7 +264,13 @@ private:
                 goto done;
             }
     
-            if (strncmp(filesystemType, "cgroup", 6) == 0)
+            bool isSubsystemMatch = false;
+            if (is_subsystem == nullptr)
+            {
+                // cgroup v2 has a single mount of the unified hierarchy
+                isSubsystemMatch = strcmp(filesystemType, "cgroup2") == 0;
+            }
+            else if (strncmp(filesystemType, "cgroup", 6) == 0)
             {
                 char* context = nullptr;
                 char* strTok = strtok_r(options, ",", &context); 
@@ -228,29 +278,35 @@ private:
                 {
                     if (is_subsystem(strTok))
                     {
-                        mountpath = (char*)malloc(lineLen+1);
-                        if (mountpath == nullptr)
-                            goto done;
-                        mountroot = (char*)malloc(lineLen+1);
-                        if (mountroot == nullptr)
-                            goto done;
-    
-                        sscanfRet = sscanf(line,
-                                           "%*s %*s %*s %s %s ",
-                                           mountroot,
-                                           mountpath);
-                        if (sscanfRet != 2)
-                            assert(!"Failed to parse mount info file contents with sscanf.");
-
-                        // assign the output arguments and clear the locals so we don't free them.
-                        *pmountpath = mountpath;
-                        *pmountroot = mountroot;
-                        mountpath = mountroot = nullptr;
-                        goto done;
+                        isSubsystemMatch = true;
+                        break;
                     }
                     strTok = strtok_r(nullptr, ",", &context);
                 }
             }
+
+            if (isSubsystemMatch)
+            {
+                mountpath = (char*)malloc(lineLen+1);
+                if (mountpath == nullptr)
+                    goto done;
+                mountroot = (char*)malloc(lineLen+1);
+                if (mountroot == nullptr)
+                    goto done;
+
+                sscanfRet = sscanf(line,
+                                   "%*s %*s %*s %s %s ",
+                                   mountroot,
+                                   mountpath);
+                if (sscanfRet != 2)
+                    assert(!"Failed to parse mount info file contents with sscanf.");
+
+                // assign the output arguments and clear the locals so we don't free them.
+                *pmountpath = mountpath;
+                *pmountroot = mountroot;
+                mountpath = mountroot = nullptr;
+                goto done;
+            }
         }
     done:
         free(mountpath);
@@ -290,6 +346,16 @@ private:
                 maxLineLen = lineLen;
             }
                    
+            if (is_subsystem == nullptr)
+            {
+                // cgroup v2 has a single entry for the unified hierarchy, with hierarchy ID 0 and no controllers
+                if (sscanf(line, "0::%s", cgroup_path) == 1)
+                {
+                    result = true;
+                }
+                continue;
+            }
+
             // See man page of proc to get format for /proc/self/cgroup file
             int sscanfRet = sscanf(line, 
                                    "%*[^:]:%[^:]:%s",
@@ -344,6 +410,14 @@ private:
         
         if (getline(&line, &lineLen, file) == -1)
             goto done;
+
+        // cgroup v2 uses "max" for no limit
+        if (strncmp(line, "max", 3) == 0)
+        {
+            *val = std::numeric_limits<uint64_t>::max();
+            result = true;
+            goto done;
+        }
     
         errno = 0;
         num = strtoull(line, &endptr, 0); 
@@ -394,6 +468,49 @@ private:
         return val;
     }
 
+    // Reads cgroup v2 cpu.max, which holds "$MAX $PERIOD" where $MAX is "max" when there is no quota.
+    static bool ReadCGroup2CpuMax(long long *quota, long long *period)
+    {
+        char *filename = nullptr;
+        char *line = nullptr;
+        size_t lineLen = 0;
+        FILE *file = nullptr;
+        bool result = false;
+
+        if (s_cpu_cgroup_path == nullptr)
+            return false;
+
+        size_t len = strlen(s_cpu_cgroup_path) + strlen(CGROUP2_CPU_MAX_FILENAME);
+        filename = (char*)malloc(len + 1);
+        if (filename == nullptr)
+            return false;
+
+        strcpy(filename, s_cpu_cgroup_path);
+        strcat(filename, CGROUP2_CPU_MAX_FILENAME);
+
+        file = fopen(filename, "r");
+        if (file == nullptr)
+            goto done;
+
+        if (getline(&line, &lineLen, file) == -1)
+            goto done;
+
+        // No quota, so there's no CPU limit
+        if (strncmp(line, "max", 3) == 0)
+            goto done;
+
+        if (sscanf(line, "%lld %lld", quota, period) != 2)
+            goto done;
+
+        result = (*quota > 0) && (*period > 0);
+    done:
+        if (file)
+            fclose(file);
+        free(line);
+        free(filename);
+        return result;
+    }
+
     static bool ReadLongLongValueFromFile(const char* filename, long long* val)
     {
         bool result = false;
@@ -426,6 +543,7 @@ private:
     }
 };
    
+int CGroup::s_cgroup_version = 1;
 char *CGroup::s_memory_cgroup_path = nullptr;
 char *CGroup::s_cpu_cgroup_path = nullptr;
 
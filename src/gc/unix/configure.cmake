@@ -46,6 +46,15 @@ check_cxx_source_compiles("
     }
     " HAVE_MAP_HUGETLB)
 
+check_cxx_source_compiles("
+    #include <sys/mman.h>
+
+    int main()
+    {
+        return MADV_HUGEPAGE;
+    }
+    " HAVE_MADV_HUGEPAGE)
+
 check_cxx_source_compiles("
 #include <pthread_np.h>
 int main(int argc, char **argv) {
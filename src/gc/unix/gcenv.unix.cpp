@@ -438,6 +438,12 @@ bool GCToOSInterface::CanGetCurrentProcessorNumber()
     return HAVE_SCHED_GETCPU;
 }
 
+// Check if the OS can honour VirtualReserveFlags::TransparentLargePages
+bool GCToOSInterface::CanUseTransparentLargePages()
+{
+    return HAVE_MADV_HUGEPAGE;
+}
+
 // Flush write buffers of processors that are executing threads of the current process
 void GCToOSInterface::FlushProcessWriteBuffers()
 {
@@ -556,6 +562,15 @@ static void* VirtualReserveInner(size_t size, size_t alignment, uint32_t flags,
         pRetVal = pAlignedRetVal;
     }
 
+#if HAVE_MADV_HUGEPAGE
+    if ((pRetVal != MAP_FAILED) && (flags & VirtualReserveFlags::TransparentLargePages))
+    {
+        // This is only advice - if transparent huge pages are disabled we just
+        // get normal pages.
+        madvise(pRetVal, size, MADV_HUGEPAGE);
+    }
+#endif // HAVE_MADV_HUGEPAGE
+
     return pRetVal;
 }
 
@@ -646,16 +661,27 @@ bool GCToOSInterface::VirtualCommit(void* address, size_t size, uint16_t node)
 // Parameters:
 //  address - starting virtual address
 //  size    - size of the virtual memory range
+//  flags   - the VirtualReserveFlags the range was reserved with
 // Return:
 //  true if it has succeeded, false if it has failed
-bool GCToOSInterface::VirtualDecommit(void* address, size_t size)
+bool GCToOSInterface::VirtualDecommit(void* address, size_t size, uint32_t flags)
 {
     // TODO: This can fail, however the GC does not handle the failure gracefully
     // Explicitly calling mmap instead of mprotect here makes it
     // that much more clear to the operating system that we no
     // longer need these pages. Also, GC depends on re-commited pages to
     // be zeroed-out.
-    return mmap(address, size, PROT_NONE, MAP_FIXED | MAP_ANON | MAP_PRIVATE, -1, 0) != NULL;
+    bool success = mmap(address, size, PROT_NONE, MAP_FIXED | MAP_ANON | MAP_PRIVATE, -1, 0) != NULL;
+
+#if HAVE_MADV_HUGEPAGE
+    // The new mapping doesn't have the advice of the one it replaced.
+    if (success && (flags & VirtualReserveFlags::TransparentLargePages))
+    {
+        madvise(address, size, MADV_HUGEPAGE);
+    }
+#endif // HAVE_MADV_HUGEPAGE
+
+    return success;
 }
 
 // Reset virtual memory range. Indicates that data in the memory range specified by address and size is no
@@ -688,6 +688,13 @@ bool GCToOSInterface::CanGetCurrentProcessorNumber()
     return true;
 }
 
+// Check if the OS can honour VirtualReserveFlags::TransparentLargePages
+bool GCToOSInterface::CanUseTransparentLargePages()
+{
+    // Windows has no transparent large pages
+    return false;
+}
+
 // Flush write buffers of processors that are executing threads of the current process
 void GCToOSInterface::FlushProcessWriteBuffers()
 {
@@ -811,7 +818,7 @@ bool GCToOSInterface::VirtualCommit(void* address, size_t size, uint16_t node)
 //  size    - size of the virtual memory range
 // Return:
 //  true if it has succeeded, false if it has failed
-bool GCToOSInterface::VirtualDecommit(void* address, size_t size)
+bool GCToOSInterface::VirtualDecommit(void* address, size_t size, uint32_t flags)
 {
     return !!::VirtualFree(address, size, MEM_DECOMMIT);
 }
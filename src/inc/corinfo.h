@@ -217,11 +217,11 @@ TODO: Talk about initializing strutures before use
 #endif
 #endif
 
-SELECTANY const GUID JITEEVersionIdentifier = { /* aec2498a-ca70-408e-903e-1e6d84e90bd2 */
-    0xaec2498a,
-    0xca70,
-    0x408e,
-    {0x90, 0x3e, 0x1e, 0x6d, 0x84, 0xe9, 0x0b, 0xd2}
+SELECTANY const GUID JITEEVersionIdentifier = { /* 0d7c4a1b-86e3-4b5f-a2c9-7f31e85b94d6 */
+    0x0d7c4a1b,
+    0x86e3,
+    0x4b5f,
+    {0xa2, 0xc9, 0x7f, 0x31, 0xe8, 0x5b, 0x94, 0xd6}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -572,6 +572,7 @@ enum CorInfoHelpFunc
     /* Miscellaneous */
 
     CORINFO_HELP_BBT_FCN_ENTER,         // record the entry to a method for collecting Tuning data
+    CORINFO_HELP_CLASSPROFILE,          // record the class of the receiver at a virtual or interface call site
 
     CORINFO_HELP_PINVOKE_CALLI,         // Indirect pinvoke call
     CORINFO_HELP_TAILCALL,              // Perform a tail call
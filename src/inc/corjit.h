@@ -395,6 +395,18 @@ public:
         UINT32 ExecutionCount;
     };
 
+    // Classes of the receivers seen at a virtual or interface call site, recorded by CORINFO_HELP_CLASSPROFILE. Class
+    // profiles are laid over consecutive BlockCounts entries that follow the block counts of a method, and are told apart
+    // from them by CLASS_FLAG in ILOffset. ClassTable is a uniform sample of the classes seen so far.
+    struct ClassProfile
+    {
+        enum { SIZE = 8, CLASS_FLAG = 0x80000000 };
+
+        UINT32 ILOffset;
+        UINT32 Count;
+        CORINFO_CLASS_HANDLE ClassTable[SIZE];
+    };
+
     // allocate a basic block profile buffer where execution counts will be stored
     // for jitted basic blocks.
     virtual HRESULT allocMethodBlockCounts (
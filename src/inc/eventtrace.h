@@ -276,7 +276,8 @@ namespace ETW
               GC_ROOT_HANDLES = 2,
               GC_ROOT_OLDER = 3,
               GC_ROOT_SIZEDREF = 4,
-              GC_ROOT_OVERFLOW = 5
+              GC_ROOT_OVERFLOW = 5,
+              GC_ROOT_DH_HANDLES = 6
             } GC_ROOT_KIND;
             struct {
                 ULONG Count;
@@ -322,6 +323,9 @@ namespace ETW
 
         static BOOL ShouldWalkHeapObjectsForEtw();
         static BOOL ShouldWalkHeapRootsForEtw();
+        static BOOL IsBackgroundHeapDumpInProgress();
+        static BOOL IsBackgroundHeapDumpPending();
+        static BOOL ShouldDoBackgroundHeapDump();
         static BOOL ShouldTrackMovementForEtw();
         static HRESULT ForceGCForDiagnostics();
         static VOID ForceGC(LONGLONG l64ClientSequenceNumber);
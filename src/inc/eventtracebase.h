@@ -96,10 +96,16 @@ enum EtwThreadFlags
 
 
 #else //!defined(FEATURE_PAL)
+// Without ETW descriptors the startup events are fired through their generated FireEtw helpers,
+// which do their own enabled checks. The end event is fired by a local holder at scope exit.
+#define ETWOnStartup(StartEventName, EndEventName) \
+    FireEtw##StartEventName(GetClrInstanceId()); \
+    struct ETWTraceStartup##StartEventName { ~ETWTraceStartup##StartEventName() { FireEtw##EndEventName(GetClrInstanceId()); } } trace##StartEventName;
+#define ETWFireEvent(EventName) \
+    FireEtw##EventName(GetClrInstanceId());
+
 #if defined(FEATURE_PERFTRACING)
 #define ETW_INLINE
-#define ETWOnStartup(StartEventName, EndEventName)
-#define ETWFireEvent(EventName)
 
 #define ETW_TRACING_INITIALIZED(RegHandle) (TRUE)
 #define ETW_EVENT_ENABLED(Context, EventDescriptor) (EventPipeHelper::IsEnabled(Context, EventDescriptor.Level, EventDescriptor.Keyword) || \
@@ -112,8 +118,6 @@ enum EtwThreadFlags
 #define ETW_PROVIDER_ENABLED(ProviderSymbol) (TRUE)
 #else //defined(FEATURE_PERFTRACING)
 #define ETW_INLINE
-#define ETWOnStartup(StartEventName, EndEventName)
-#define ETWFireEvent(EventName)
 
 #define ETW_TRACING_INITIALIZED(RegHandle) (TRUE)
 #define ETW_CATEGORY_ENABLED(Context, Level, Keyword) (XplatEventLogger::IsKeywordEnabled(Context, Level, Keyword))
@@ -593,7 +597,18 @@ class EventPipeHelper
 {
 public:
     static bool Enabled();
-    static bool IsEnabled(DOTNET_TRACE_CONTEXT Context, UCHAR Level, ULONGLONG Keyword);
+
+    // This is the check behind every ETW_*_ENABLED macro, so it is inlined and looks at the
+    // provider context in place rather than being a call that copies it.
+    inline static bool IsEnabled(const DOTNET_TRACE_CONTEXT& Context, UCHAR Level, ULONGLONG Keyword)
+    {
+        if (Level <= Context.EventPipeProvider.Level || Context.EventPipeProvider.Level == 0)
+        {
+            return (Keyword == (ULONGLONG)0) || (Keyword & Context.EventPipeProvider.EnabledKeywordsBitmask) != 0;
+        }
+
+        return false;
+    }
 };
 #endif // defined(FEATURE_PERFTRACING)
 
@@ -875,6 +890,7 @@ namespace ETW
         static VOID GetR2RGetEntryPoint(MethodDesc *pMethodDesc, PCODE pEntryPoint);
         static VOID MethodJitting(MethodDesc *pMethodDesc, SString *namespaceOrClassName, SString *methodName, SString *methodSignature);
         static VOID MethodJitted(MethodDesc *pMethodDesc, SString *namespaceOrClassName, SString *methodName, SString *methodSignature, PCODE pNativeCodeStartAddress, PrepareCodeConfig *pConfig);
+        static VOID MethodJitStats(MethodDesc *pMethodDesc, ULONG ulNativeCodeSize, LONGLONG llJitTimeTicks, PrepareCodeConfig *pConfig);
         static VOID StubInitialized(ULONGLONG ullHelperStartAddress, LPCWSTR pHelperName);
         static VOID StubsInitialized(PVOID *pHelperStartAddresss, PVOID *pHelperNames, LONG ulNoOfHelpers);
         static VOID MethodRestored(MethodDesc * pMethodDesc);
@@ -885,6 +901,7 @@ namespace ETW
         static VOID GetR2RGetEntryPoint(MethodDesc *pMethodDesc, PCODE pEntryPoint) {};
         static VOID MethodJitting(MethodDesc *pMethodDesc, SString *namespaceOrClassName, SString *methodName, SString *methodSignature);
         static VOID MethodJitted(MethodDesc *pMethodDesc, SString *namespaceOrClassName, SString *methodName, SString *methodSignature, PCODE pNativeCodeStartAddress, PrepareCodeConfig *pConfig);
+        static VOID MethodJitStats(MethodDesc *pMethodDesc, ULONG ulNativeCodeSize, LONGLONG llJitTimeTicks, PrepareCodeConfig *pConfig) {};
         static VOID StubInitialized(ULONGLONG ullHelperStartAddress, LPCWSTR pHelperName) {};
         static VOID StubsInitialized(PVOID *pHelperStartAddresss, PVOID *pHelperNames, LONG ulNoOfHelpers) {};
         static VOID MethodRestored(MethodDesc * pMethodDesc) {};
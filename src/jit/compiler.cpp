@@ -3513,6 +3513,7 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     fgBlockCounts                = nullptr;
     fgProfileData_ILSizeMismatch = false;
     fgNumProfileRuns             = 0;
+    fgClassProfileCandidates     = nullptr;
     if (jitFlags->IsSet(JitFlags::JIT_FLAG_BBOPT))
     {
         assert(!compIsForInlining());
@@ -3624,6 +3625,16 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
         opts.compGCPollType = GCPOLL_INLINE;
     }
 
+    // Polling on loop back edges lets methods with loops stay partially interruptible. The VM keeps
+    // hijacking return addresses, so return blocks don't need polls in this mode.
+    opts.compGCPollLoopsOnly = false;
+    if ((opts.compGCPollType == GCPOLL_NONE) && (JitConfig.JitGCPollLoops() != 0) &&
+        !jitFlags->IsSet(JitFlags::JIT_FLAG_PREJIT) && !compIsForInlining())
+    {
+        opts.compGCPollType      = GCPOLL_INLINE;
+        opts.compGCPollLoopsOnly = true;
+    }
+
 #ifdef PROFILING_SUPPORTED
 #ifdef UNIX_AMD64_ABI
     if (compIsProfilerHookNeeded())
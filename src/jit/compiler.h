@@ -3497,7 +3497,8 @@ public:
                              CORINFO_CONTEXT_HANDLE* contextHandle,
                              CORINFO_CONTEXT_HANDLE* exactContextHandle,
                              bool                    isLateDevirtualization,
-                             bool                    isExplicitTailCall);
+                             bool                    isExplicitTailCall,
+                             IL_OFFSET               ilOffset = BAD_IL_OFFSET);
 
     //=========================================================================
     //                          PROTECTED
@@ -3615,6 +3616,7 @@ protected:
                                        CORINFO_METHOD_HANDLE method,
                                        CORINFO_SIG_INFO*     sig,
                                        bool                  mustExpand);
+    GenTree* impBitOperationsIntrinsic(NamedIntrinsic ni, CORINFO_SIG_INFO* sig);
 
 protected:
     bool compSupportsHWIntrinsic(InstructionSet isa);
@@ -5189,6 +5191,16 @@ protected:
     UINT32                    fgBlockCountsCount;
     UINT32                    fgNumProfileRuns;
 
+    // Virtual and interface call sites of instrumented tier 0 code whose receiver classes are recorded
+    struct ClassProfileCandidateInfo
+    {
+        GenTreeCall*               call;
+        IL_OFFSET                  ilOffset;
+        ClassProfileCandidateInfo* next;
+    };
+
+    ClassProfileCandidateInfo* fgClassProfileCandidates;
+
     unsigned fgStressBBProf()
     {
 #ifdef DEBUG
@@ -5208,6 +5220,9 @@ protected:
 
     bool fgHaveProfileData();
     bool fgGetProfileWeightForBasicBlock(IL_OFFSET offset, unsigned* weight);
+    void fgAddClassProfileCandidate(GenTreeCall* call, IL_OFFSET ilOffset);
+    void fgInsertClassProfileProbe(GenTreeCall* call, ICorJitInfo::ClassProfile* classProfile);
+    CORINFO_CLASS_HANDLE fgGetLikelyClass(IL_OFFSET ilOffset);
     void fgInstrumentMethod();
 
 public:
@@ -6341,7 +6356,8 @@ public:
                                              CORINFO_METHOD_HANDLE methodHandle,
                                              CORINFO_CLASS_HANDLE  classHandle,
                                              unsigned              methodAttr,
-                                             unsigned              classAttr);
+                                             unsigned              classAttr,
+                                             bool                  classFromProfile = false);
 
     unsigned optMethodFlags;
 
@@ -8533,6 +8549,7 @@ public:
 #endif
 
         GCPollType compGCPollType;
+        bool       compGCPollLoopsOnly; // Only loop back edges get GC polls, see JitGCPollLoops
     } opts;
 
 #ifdef ALT_JIT
@@ -234,6 +234,12 @@ bool Compiler::fgGetProfileWeightForBasicBlock(IL_OFFSET offset, unsigned* weigh
     noway_assert(!compIsForInlining());
     for (UINT32 i = 0; i < fgBlockCountsCount; i++)
     {
+        // Class profiles, if any, follow the block counts
+        if ((fgBlockCounts[i].ILOffset & ICorJitInfo::ClassProfile::CLASS_FLAG) != 0)
+        {
+            break;
+        }
+
         if (fgBlockCounts[i].ILOffset == offset)
         {
             weight = fgBlockCounts[i].ExecutionCount;
@@ -247,6 +253,169 @@ bool Compiler::fgGetProfileWeightForBasicBlock(IL_OFFSET offset, unsigned* weigh
     return true;
 }
 
+//------------------------------------------------------------------------
+// fgAddClassProfileCandidate: note a virtual or interface call site of
+//    instrumented tier 0 code whose receiver classes should be recorded
+//
+// Arguments:
+//    call - the virtual or interface call
+//    ilOffset - IL offset of the call
+//
+// Notes:
+//    The probes are inserted by fgInstrumentMethod, once the profile buffer
+//    has been allocated.
+//
+void Compiler::fgAddClassProfileCandidate(GenTreeCall* call, IL_OFFSET ilOffset)
+{
+    assert(!compIsForInlining());
+    assert(call->IsVirtual());
+
+    if ((ilOffset == BAD_IL_OFFSET) || (JitConfig.JitClassProfiling() == 0))
+    {
+        return;
+    }
+
+    // A block may be imported more than once, only keep the latest call for an IL offset
+    for (ClassProfileCandidateInfo* candidate = fgClassProfileCandidates; candidate != nullptr;
+         candidate                            = candidate->next)
+    {
+        if (candidate->ilOffset == ilOffset)
+        {
+            candidate->call = call;
+            return;
+        }
+    }
+
+    ClassProfileCandidateInfo* candidate = new (this, CMK_Generic) ClassProfileCandidateInfo;
+    candidate->call                      = call;
+    candidate->ilOffset                  = ilOffset;
+    candidate->next                      = fgClassProfileCandidates;
+    fgClassProfileCandidates             = candidate;
+}
+
+//------------------------------------------------------------------------
+// fgInsertClassProfileProbe: record the class of the receiver of a virtual
+//    or interface call before making the call
+//
+// Arguments:
+//    call - the virtual or interface call
+//    classProfile - the class profile for the call site
+//
+// Notes:
+//    The receiver is evaluated once into a temp:
+//      this = COMMA(ASG(tmp, this), COMMA(CALL CORINFO_HELP_CLASSPROFILE(tmp, classProfile), tmp))
+//
+void Compiler::fgInsertClassProfileProbe(GenTreeCall* call, ICorJitInfo::ClassProfile* classProfile)
+{
+    assert(call->IsVirtual());
+    assert(call->gtCallThisArg != nullptr);
+
+    GenTree* const objNode = call->gtCallThisArg->GetNode();
+    assert(objNode->TypeGet() == TYP_REF);
+
+    const unsigned tmpNum  = lvaGrabTemp(true DEBUGARG("class profile tmp"));
+    GenTree* const asgNode = gtNewTempAssign(tmpNum, objNode);
+
+    GenTree* const    profileNode = gtNewIconHandleNode((size_t)classProfile, GTF_ICON_BBC_PTR);
+    GenTreeCall::Use* args        = gtNewCallArgs(gtNewLclvNode(tmpNum, TYP_REF), profileNode);
+    GenTree* const    helperNode  = gtNewHelperCallNode(CORINFO_HELP_CLASSPROFILE, TYP_VOID, args);
+
+    GenTree* const newThisNode =
+        gtNewOperNode(GT_COMMA, TYP_REF, asgNode,
+                      gtNewOperNode(GT_COMMA, TYP_REF, helperNode, gtNewLclvNode(tmpNum, TYP_REF)));
+
+    call->gtCallThisArg->SetNode(newThisNode);
+    call->gtFlags |= newThisNode->gtFlags & GTF_ALL_EFFECT;
+}
+
+//------------------------------------------------------------------------
+// fgGetLikelyClass: find the class that the receiver of a virtual or
+//    interface call is likely to have, from the class profile recorded
+//    by the instrumented tier 0 code of the method
+//
+// Arguments:
+//    ilOffset - IL offset of the call
+//
+// Returns:
+//    The class that accounts for at least JitClassProfileLikelihood percent
+//    of the recorded receiver classes, or NO_CLASS_HANDLE
+//
+CORINFO_CLASS_HANDLE Compiler::fgGetLikelyClass(IL_OFFSET ilOffset)
+{
+    if (!fgHaveProfileData() || (ilOffset == BAD_IL_OFFSET) || (JitConfig.JitClassProfiling() == 0))
+    {
+        return NO_CLASS_HANDLE;
+    }
+
+    const UINT32 blockCountsPerClassProfile = sizeof(ICorJitInfo::ClassProfile) / sizeof(ICorJitInfo::BlockCounts);
+
+    // Skip over the block counts
+    UINT32 i = 0;
+    while ((i < fgBlockCountsCount) && ((fgBlockCounts[i].ILOffset & ICorJitInfo::ClassProfile::CLASS_FLAG) == 0))
+    {
+        i++;
+    }
+
+    for (; i + blockCountsPerClassProfile <= fgBlockCountsCount; i += blockCountsPerClassProfile)
+    {
+        const ICorJitInfo::ClassProfile* classProfile = (const ICorJitInfo::ClassProfile*)&fgBlockCounts[i];
+        if (classProfile->ILOffset != (ilOffset | ICorJitInfo::ClassProfile::CLASS_FLAG))
+        {
+            continue;
+        }
+
+        // The instrumented code may still be running, take a snapshot of the sample
+        CORINFO_CLASS_HANDLE classTable[ICorJitInfo::ClassProfile::SIZE];
+        UINT32               sampleCount = classProfile->Count;
+        if (sampleCount > ICorJitInfo::ClassProfile::SIZE)
+        {
+            sampleCount = ICorJitInfo::ClassProfile::SIZE;
+        }
+        for (UINT32 j = 0; j < sampleCount; j++)
+        {
+            classTable[j] = classProfile->ClassTable[j];
+        }
+
+        CORINFO_CLASS_HANDLE likelyClass = NO_CLASS_HANDLE;
+        UINT32               likelyCount = 0;
+        for (UINT32 j = 0; j < sampleCount; j++)
+        {
+            if ((classTable[j] == NO_CLASS_HANDLE) || (classTable[j] == likelyClass))
+            {
+                continue;
+            }
+
+            UINT32 count = 0;
+            for (UINT32 k = j; k < sampleCount; k++)
+            {
+                if (classTable[k] == classTable[j])
+                {
+                    count++;
+                }
+            }
+
+            if (count > likelyCount)
+            {
+                likelyClass = classTable[j];
+                likelyCount = count;
+            }
+        }
+
+        if ((likelyClass == NO_CLASS_HANDLE) ||
+            (likelyCount * 100 < (UINT32)JitConfig.JitClassProfileLikelihood() * sampleCount))
+        {
+            JITDUMP("No likely class for call at IL offset 0x%x\n", ilOffset);
+            return NO_CLASS_HANDLE;
+        }
+
+        JITDUMP("Likely class for call at IL offset 0x%x is %p (%s), %u of %u samples\n", ilOffset,
+                dspPtr(likelyClass), eeGetClassName(likelyClass), likelyCount, sampleCount);
+        return likelyClass;
+    }
+
+    return NO_CLASS_HANDLE;
+}
+
 void Compiler::fgInstrumentMethod()
 {
     noway_assert(!compIsForInlining());
@@ -264,11 +433,25 @@ void Compiler::fgInstrumentMethod()
         countOfBlocks++;
     }
 
+    // Count the class profiles of virtual and interface call sites, each is laid over several BlockCounts tuples
+
+    static_assert_no_msg((sizeof(ICorJitInfo::ClassProfile) % sizeof(ICorJitInfo::BlockCounts)) == 0);
+    const int blockCountsPerClassProfile = sizeof(ICorJitInfo::ClassProfile) / sizeof(ICorJitInfo::BlockCounts);
+
+    int countOfClassProfiles = 0;
+    for (ClassProfileCandidateInfo* candidate = fgClassProfileCandidates; candidate != nullptr;
+         candidate                            = candidate->next)
+    {
+        countOfClassProfiles++;
+    }
+
     // Allocate the profile buffer
 
     ICorJitInfo::BlockCounts* profileBlockCountsStart;
 
-    HRESULT res = info.compCompHnd->allocMethodBlockCounts(countOfBlocks, &profileBlockCountsStart);
+    HRESULT res = info.compCompHnd->allocMethodBlockCounts(countOfBlocks +
+                                                               countOfClassProfiles * blockCountsPerClassProfile,
+                                                           &profileBlockCountsStart);
 
     Statement* stmt;
 
@@ -336,6 +519,19 @@ void Compiler::fgInstrumentMethod()
         // Check that we allocated and initialized the same number of BlockCounts tuples
         noway_assert(countOfBlocks == 0);
 
+        // The class profiles follow the block counts
+        for (ClassProfileCandidateInfo* candidate = fgClassProfileCandidates; candidate != nullptr;
+             candidate                            = candidate->next)
+        {
+            ICorJitInfo::ClassProfile* classProfile = (ICorJitInfo::ClassProfile*)currentBlockCounts;
+            classProfile->ILOffset                  = candidate->ilOffset | ICorJitInfo::ClassProfile::CLASS_FLAG;
+            assert(classProfile->Count == 0); // This value should already be zero-ed out
+
+            fgInsertClassProfileProbe(candidate->call, classProfile);
+
+            currentBlockCounts += blockCountsPerClassProfile;
+        }
+
         // Add the method entry callback node
 
         GenTree* arg;
@@ -3513,9 +3709,10 @@ void Compiler::fgMarkGCPollBlocks()
 
     BasicBlock* block;
 
-    // Return blocks always need GC polls.  In addition, all back edges (including those from switch
-    // statements) need GC polls.  The poll is on the block with the outgoing back edge (or ret), rather than
-    // on the destination or on the edge itself.
+    // Return blocks always need GC polls, unless only loops are polled and returns are left to
+    // hijacking.  In addition, all back edges (including those from switch statements) need GC polls.
+    // The poll is on the block with the outgoing back edge (or ret), rather than on the destination
+    // or on the edge itself.
     for (block = fgFirstBB; block; block = block->bbNext)
     {
         bool blockNeedsPoll = false;
@@ -3527,7 +3724,7 @@ void Compiler::fgMarkGCPollBlocks()
                 break;
 
             case BBJ_RETURN:
-                blockNeedsPoll = true;
+                blockNeedsPoll = !opts.compGCPollLoopsOnly;
                 break;
 
             case BBJ_SWITCH:
@@ -19024,8 +19221,9 @@ void Compiler::fgSetBlockOrder()
             // already added polls and then marked as being GC safe
             // (BBF_GC_SAFE_POINT). Thus we can only reach here when *NOT*
             // using GC polls, but instead relying on the JIT to generate
-            // fully-interruptible code.
-            noway_assert(GCPOLL_NONE == opts.compGCPollType);
+            // fully-interruptible code. When only loops are polled the return
+            // blocks are not polled either.
+            noway_assert((GCPOLL_NONE == opts.compGCPollType) || opts.compGCPollLoopsOnly);
 
             // This tail call might combine with other tail calls to form a
             // loop.  Thus we need to either add a poll, or make the method
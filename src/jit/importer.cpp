@@ -3481,6 +3481,18 @@ GenTree* Compiler::impIntrinsic(GenTree*                newobjThis,
 
                 return hwintrinsic;
             }
+
+            if ((ni >= NI_System_Numerics_BitOperations_LeadingZeroCount) &&
+                (ni <= NI_System_Numerics_BitOperations_TrailingZeroCount))
+            {
+                // This is always cheaper than the call, so it's done even when optimizations are disabled.
+                GenTree* bitOperation = impBitOperationsIntrinsic(ni, sig);
+
+                if (bitOperation != nullptr)
+                {
+                    return bitOperation;
+                }
+            }
 #endif // FEATURE_HW_INTRINSICS
         }
     }
@@ -4125,6 +4137,72 @@ GenTree* Compiler::impIntrinsic(GenTree*                newobjThis,
     return retNode;
 }
 
+#ifdef FEATURE_HW_INTRINSICS
+//------------------------------------------------------------------------
+// impBitOperationsIntrinsic: Expand a BitOperations bit counting method as
+//    the equivalent scalar hardware intrinsic.
+//
+// Arguments:
+//    ni  - NI_System_Numerics_BitOperations_* intrinsic to expand
+//    sig - signature of the call
+//
+// Return Value:
+//    The expanded tree, or nullptr if the ISA isn't available, in which
+//    case the stack is left untouched and the call is imported as usual.
+//
+// Notes:
+//    BitOperations returns the same results as LZCNT, POPCNT and TZCNT,
+//    including for a zero input, so no fallback code is needed. This is
+//    done before the check for disabled optimizations in impIntrinsic, so
+//    tier 0 and minopts callers don't pay for a call either. The 64-bit
+//    overloads are only expanded on 64-bit archs.
+//
+GenTree* Compiler::impBitOperationsIntrinsic(NamedIntrinsic ni, CORINFO_SIG_INFO* sig)
+{
+#ifdef _TARGET_XARCH_
+    assert(sig->numArgs == 1);
+    assert(JITtype2varType(sig->retType) == TYP_INT);
+
+    var_types      opType        = genActualType(impStackTop().val->TypeGet());
+    bool           is64Bit       = (opType == TYP_LONG);
+    NamedIntrinsic hwIntrinsicId = NI_Illegal;
+
+    switch (ni)
+    {
+        case NI_System_Numerics_BitOperations_LeadingZeroCount:
+            hwIntrinsicId = is64Bit ? NI_LZCNT_X64_LeadingZeroCount : NI_LZCNT_LeadingZeroCount;
+            break;
+
+        case NI_System_Numerics_BitOperations_PopCount:
+            hwIntrinsicId = is64Bit ? NI_POPCNT_X64_PopCount : NI_POPCNT_PopCount;
+            break;
+
+        default:
+            assert(ni == NI_System_Numerics_BitOperations_TrailingZeroCount);
+            hwIntrinsicId = is64Bit ? NI_BMI1_X64_TrailingZeroCount : NI_BMI1_TrailingZeroCount;
+            break;
+    }
+
+    if (!compSupports(HWIntrinsicInfo::lookupIsa(hwIntrinsicId)))
+    {
+        return nullptr;
+    }
+
+    GenTree* retNode = gtNewScalarHWIntrinsicNode(opType, impPopStack().val, hwIntrinsicId);
+
+    if (is64Bit)
+    {
+        // The count always fits in an int.
+        retNode = gtNewCastNode(TYP_INT, retNode, false, TYP_INT);
+    }
+
+    return retNode;
+#else  // !_TARGET_XARCH_
+    return nullptr;
+#endif // !_TARGET_XARCH_
+}
+#endif // FEATURE_HW_INTRINSICS
+
 GenTree* Compiler::impMathIntrinsic(CORINFO_METHOD_HANDLE method,
                                     CORINFO_SIG_INFO*     sig,
                                     var_types             callType,
@@ -4294,6 +4372,26 @@ NamedIntrinsic Compiler::lookupNamedIntrinsic(CORINFO_METHOD_HANDLE method)
         }
     }
 #endif // !defined(_TARGET_XARCH_)
+#if defined(FEATURE_HW_INTRINSICS) && defined(_TARGET_XARCH_)
+    else if (strcmp(namespaceName, "System.Numerics") == 0)
+    {
+        if (strcmp(className, "BitOperations") == 0)
+        {
+            if (strcmp(methodName, "LeadingZeroCount") == 0)
+            {
+                result = NI_System_Numerics_BitOperations_LeadingZeroCount;
+            }
+            else if (strcmp(methodName, "PopCount") == 0)
+            {
+                result = NI_System_Numerics_BitOperations_PopCount;
+            }
+            else if (strcmp(methodName, "TrailingZeroCount") == 0)
+            {
+                result = NI_System_Numerics_BitOperations_TrailingZeroCount;
+            }
+        }
+    }
+#endif // FEATURE_HW_INTRINSICS && _TARGET_XARCH_
     else if (strcmp(namespaceName, "System.Collections.Generic") == 0)
     {
         if ((strcmp(className, "EqualityComparer`1") == 0) && (strcmp(methodName, "get_Default") == 0))
@@ -8252,7 +8350,14 @@ var_types Compiler::impImportCall(OPCODE                  opcode,
             bool       explicitTailCall       = (tailCall & PREFIX_TAILCALL_EXPLICIT) != 0;
             const bool isLateDevirtualization = false;
             impDevirtualizeCall(call->AsCall(), &callInfo->hMethod, &callInfo->methodFlags, &callInfo->contextHandle,
-                                &exactContextHnd, isLateDevirtualization, explicitTailCall);
+                                &exactContextHnd, isLateDevirtualization, explicitTailCall, rawILOffset);
+
+            // Instrumented tier 0 code records the receiver classes for the optimized code to guess for.
+            if (call->AsCall()->IsVirtual() && opts.jitFlags->IsSet(JitFlags::JIT_FLAG_BBINSTR) &&
+                opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0) && !compIsForInlining())
+            {
+                fgAddClassProfileCandidate(call->AsCall(), rawILOffset);
+            }
         }
 
         if (impIsThis(obj))
@@ -18215,11 +18320,28 @@ void Compiler::impMakeDiscretionaryInlineObservations(InlineInfo* pInlineInfo, I
     // Roughly classify callsite frequency.
     InlineCallsiteFrequency frequency = InlineCallsiteFrequency::UNUSED;
 
+    // When both the call site and the root method entry have profile counts, use
+    // them in preference to the static guesses below.
+    BasicBlock* const rootEntryBlock = impInlineRoot()->fgFirstBB;
+    const bool        haveProfileCounts =
+        (pInlineInfo != nullptr) && pInlineInfo->iciBlock->hasProfileWeight() && rootEntryBlock->hasProfileWeight();
+
     // If this is a prejit root, or a maximally hot block...
     if ((pInlineInfo == nullptr) || (pInlineInfo->iciBlock->bbWeight >= BB_MAX_WEIGHT))
     {
         frequency = InlineCallsiteFrequency::HOT;
     }
+    // The profile says this call site was never reached.
+    else if (haveProfileCounts && (pInlineInfo->iciBlock->bbWeight == BB_ZERO_WEIGHT))
+    {
+        frequency = InlineCallsiteFrequency::RARE;
+    }
+    // The profile says this call site runs many times per call of the root method.
+    else if (haveProfileCounts && (rootEntryBlock->bbWeight > BB_ZERO_WEIGHT) &&
+             (pInlineInfo->iciBlock->bbWeight / BB_LOOP_WEIGHT >= rootEntryBlock->bbWeight))
+    {
+        frequency = InlineCallsiteFrequency::HOT;
+    }
     // No training data.  Look for loop-like things.
     // We consider a recursive call loop-like.  Do not give the inlining boost to the method itself.
     // However, give it to things nearby.
@@ -19912,7 +20034,8 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
                                    CORINFO_CONTEXT_HANDLE* contextHandle,
                                    CORINFO_CONTEXT_HANDLE* exactContextHandle,
                                    bool                    isLateDevirtualization,
-                                   bool                    isExplicitTailCall)
+                                   bool                    isExplicitTailCall,
+                                   IL_OFFSET               ilOffset)
 {
     assert(call != nullptr);
     assert(method != nullptr);
@@ -20081,53 +20204,38 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
     if ((objClassAttribs & CORINFO_FLG_INTERFACE) != 0)
     {
         // If we're called during early devirtualiztion, attempt guarded devirtualization
-        // if there's currently just one implementing class.
+        // of the class the profile says is most likely.
         if (exactContextHandle == nullptr)
         {
             JITDUMP("--- obj class is interface...unable to dervirtualize, sorry\n");
             return;
         }
 
-        CORINFO_CLASS_HANDLE uniqueImplementingClass = NO_CLASS_HANDLE;
-
-        // info.compCompHnd->getUniqueImplementingClass(objClass);
-
-        if (uniqueImplementingClass == NO_CLASS_HANDLE)
-        {
-            JITDUMP("No unique implementor of interface %p (%s), sorry\n", dspPtr(objClass), objClassName);
-            return;
-        }
-
-        JITDUMP("Only known implementor of interface %p (%s) is %p (%s)!\n", dspPtr(objClass), objClassName,
-                uniqueImplementingClass, eeGetClassName(uniqueImplementingClass));
-
-        bool guessUniqueInterface = true;
-
-        INDEBUG(guessUniqueInterface = (JitConfig.JitGuardedDevirtualizationGuessUniqueInterface() > 0););
-
-        if (!guessUniqueInterface)
+        // Guess the class from the profile recorded by the instrumented tier 0 code.
+        CORINFO_CLASS_HANDLE likelyClass = fgGetLikelyClass(ilOffset);
+        if (likelyClass == NO_CLASS_HANDLE)
         {
-            JITDUMP("Guarded devirt for unique interface implementor is not enabled, sorry\n");
+            JITDUMP("No likely class for interface %p (%s), sorry\n", dspPtr(objClass), objClassName);
             return;
         }
 
         // Ask the runtime to determine the method that would be called based on the guessed-for type.
         CORINFO_CONTEXT_HANDLE ownerType = *contextHandle;
-        CORINFO_METHOD_HANDLE  uniqueImplementingMethod =
-            info.compCompHnd->resolveVirtualMethod(baseMethod, uniqueImplementingClass, ownerType);
+        CORINFO_METHOD_HANDLE  likelyMethod =
+            info.compCompHnd->resolveVirtualMethod(baseMethod, likelyClass, ownerType);
 
-        if (uniqueImplementingMethod == nullptr)
+        if (likelyMethod == nullptr)
         {
             JITDUMP("Can't figure out which method would be invoked, sorry\n");
             return;
         }
 
-        JITDUMP("Interface call would invoke method %s\n", eeGetMethodName(uniqueImplementingMethod, nullptr));
-        DWORD uniqueMethodAttribs = info.compCompHnd->getMethodAttribs(uniqueImplementingMethod);
-        DWORD uniqueClassAttribs  = info.compCompHnd->getClassAttribs(uniqueImplementingClass);
+        JITDUMP("Profiled interface call would invoke method %s\n", eeGetMethodName(likelyMethod, nullptr));
+        DWORD likelyMethodAttribs = info.compCompHnd->getMethodAttribs(likelyMethod);
+        DWORD likelyClassAttribs  = info.compCompHnd->getClassAttribs(likelyClass);
 
-        addGuardedDevirtualizationCandidate(call, uniqueImplementingMethod, uniqueImplementingClass,
-                                            uniqueMethodAttribs, uniqueClassAttribs);
+        addGuardedDevirtualizationCandidate(call, likelyMethod, likelyClass, likelyMethodAttribs, likelyClassAttribs,
+                                            true);
         return;
     }
 
@@ -20194,6 +20302,34 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
     {
         JITDUMP("    Class not final or exact%s\n", isInterface ? "" : ", and method not final");
 
+        // Don't try guarded devirtualiztion when we're doing late devirtualization.
+        if (isLateDevirtualization)
+        {
+            JITDUMP("No guarded devirt during late devirtualization\n");
+            return;
+        }
+
+        // Prefer the likely class from the profile recorded by the instrumented tier 0 code, if any.
+        // This doesn't depend on JitGuardedDevirtualizationGuessBestClass, which only controls the
+        // guess below.
+        CORINFO_CLASS_HANDLE likelyClass = fgGetLikelyClass(ilOffset);
+        if (likelyClass != NO_CLASS_HANDLE)
+        {
+            CORINFO_METHOD_HANDLE likelyMethod =
+                info.compCompHnd->resolveVirtualMethod(baseMethod, likelyClass, ownerType);
+
+            if (likelyMethod != nullptr)
+            {
+                JITDUMP("Profiled %s call would invoke method %s\n", callKind, eeGetMethodName(likelyMethod, nullptr));
+                DWORD likelyMethodAttribs = info.compCompHnd->getMethodAttribs(likelyMethod);
+                DWORD likelyClassAttribs  = info.compCompHnd->getClassAttribs(likelyClass);
+
+                addGuardedDevirtualizationCandidate(call, likelyMethod, likelyClass, likelyMethodAttribs,
+                                                    likelyClassAttribs, true);
+                return;
+            }
+        }
+
         // Have we enabled guarded devirtualization by guessing the jit's best class?
         bool guessJitBestClass = true;
         INDEBUG(guessJitBestClass = (JitConfig.JitGuardedDevirtualizationGuessBestClass() > 0););
@@ -20204,13 +20340,6 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
             return;
         }
 
-        // Don't try guarded devirtualiztion when we're doing late devirtualization.
-        if (isLateDevirtualization)
-        {
-            JITDUMP("No guarded devirt during late devirtualization\n");
-            return;
-        }
-
         // We will use the class that introduced the method as our guess
         // for the runtime class of othe object.
         CORINFO_CLASS_HANDLE derivedClass = info.compCompHnd->getMethodClass(derivedMethod);
@@ -20616,18 +20745,20 @@ void Compiler::addFatPointerCandidate(GenTreeCall* call)
 //    classHandle - class that will be tested for at runtime
 //    methodAttr - attributes of the method
 //    classAttr - attributes of the class
+//    classFromProfile - true if the class was observed by instrumented tier 0 code
 //
 void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
                                                    CORINFO_METHOD_HANDLE methodHandle,
                                                    CORINFO_CLASS_HANDLE  classHandle,
                                                    unsigned              methodAttr,
-                                                   unsigned              classAttr)
+                                                   unsigned              classAttr,
+                                                   bool                  classFromProfile)
 {
     // This transformation only makes sense for virtual calls
     assert(call->IsVirtual());
 
-    // Only mark calls if the feature is enabled.
-    const bool isEnabled = JitConfig.JitEnableGuardedDevirtualization() > 0;
+    // Only mark calls if the feature is enabled, or if the guess comes from profile data.
+    const bool isEnabled = (JitConfig.JitEnableGuardedDevirtualization() > 0) || classFromProfile;
 
     if (!isEnabled)
     {
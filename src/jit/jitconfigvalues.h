@@ -392,12 +392,22 @@ CONFIG_INTEGER(JitEnableRemoveEmptyTry, W("JitEnableRemoveEmptyTry"), 0)
 #endif // defined(FEATURE_CORECLR)
 #endif // DEBUG
 
+// If 1, emit GC polls on loop back edges of jitted code instead of making methods with loops fully
+// interruptible. This applies to all code jitted at runtime, minopts and tier0 included, but not to
+// prejitted code. Returns are still covered by return address hijacking.
+CONFIG_INTEGER(JitGCPollLoops, W("JitGCPollLoops"), 0)
+
 // Overall master enable for Guarded Devirtualization. Currently not enabled by default.
 CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevirtualization"), 0)
 
+// Record receiver classes at virtual and interface call sites of instrumented tier 0 code, and do guarded
+// devirtualization for the likely class in the optimized code regardless of JitEnableGuardedDevirtualization
+CONFIG_INTEGER(JitClassProfiling, W("JitClassProfiling"), 1)
+// Percentage of the recorded receiver classes that the likely class must account for
+CONFIG_INTEGER(JitClassProfileLikelihood, W("JitClassProfileLikelihood"), 50)
+
 #if defined(DEBUG)
 // Various policies for GuardedDevirtualization
-CONFIG_INTEGER(JitGuardedDevirtualizationGuessUniqueInterface, W("JitGuardedDevirtualizationGuessUniqueInterface"), 1)
 CONFIG_INTEGER(JitGuardedDevirtualizationGuessBestClass, W("JitGuardedDevirtualizationGuessBestClass"), 1)
 #endif // DEBUG
 
@@ -188,7 +188,7 @@ bool LC_Condition::Evaluates(bool* pResult)
 //
 // Operation:
 //      Check if both conditions are equal. If so, return just 1 of them.
-//      Reverse their operators and check if their reversed operands match. If so, return either of them.
+//      Swap their operands and operators and check if they match. If so, return either of them.
 //
 // Notes:
 //      This is not a full-fledged expression optimizer, it is supposed
@@ -204,7 +204,7 @@ bool LC_Condition::Combines(const LC_Condition& cond, LC_Condition* newCond)
         return true;
     }
     else if ((oper == GT_LT || oper == GT_LE || oper == GT_GT || oper == GT_GE) &&
-             GenTree::ReverseRelop(oper) == cond.oper && op1 == cond.op2 && op2 == cond.op1)
+             GenTree::SwapRelop(oper) == cond.oper && op1 == cond.op2 && op2 == cond.op1)
     {
         *newCond = *this;
         return true;
@@ -744,15 +744,67 @@ GenTree* Lowering::LowerSwitch(GenTree* node)
     else
     {
         // At this point the default case has already been handled and we need to generate a jump
-        // table based switch or a bit test based switch at the end of afterDefaultCondBlock. Both
-        // switch variants need the switch value so create the necessary LclVar node here.
+        // table based switch or a bit test based switch at the end of afterDefaultCondBlock. If
+        // profile data shows that a single case dominates, test for it first and move the switch
+        // into a new block that only the remaining, colder, cases go through.
+        BasicBlock* switchBlock = afterDefaultCondBlock;
+
+        if (comp->fgHaveProfileData() && afterDefaultCondBlock->hasProfileWeight() &&
+            (afterDefaultCondBlock->bbWeight != BB_ZERO_WEIGHT))
+        {
+            unsigned dominantCase = jumpCnt - 1;
+
+            for (unsigned i = 0; i < jumpCnt - 1; i++)
+            {
+                BasicBlock* target = jumpTab[i];
+
+                // Only a target that is reached by this single case and nothing else has a weight
+                // that tells how often the case is taken.
+                if ((target->countOfInEdges() == 1) && target->hasProfileWeight() &&
+                    ((UINT64)target->bbWeight * 100 >= (UINT64)afterDefaultCondBlock->bbWeight * 80))
+                {
+                    dominantCase = i;
+                    break;
+                }
+            }
+
+            if (dominantCase < jumpCnt - 1)
+            {
+                BasicBlock* dominantTarget = jumpTab[dominantCase];
+
+                JITDUMP("Lowering switch " FMT_BB ": peeling dominant case %u (" FMT_BB ")\n", originalSwitchBB->bbNum,
+                        dominantCase, dominantTarget->bbNum);
+
+                switchBlock = comp->fgSplitBlockAtEnd(afterDefaultCondBlock);
+
+                afterDefaultCondBlock->bbJumpKind = BBJ_COND;
+                afterDefaultCondBlock->bbJumpDest = dominantTarget;
+                comp->fgAddRefPred(dominantTarget, afterDefaultCondBlock);
+
+                GenTree* gtCaseCond = comp->gtNewOperNode(GT_EQ, TYP_INT, comp->gtNewLclvNode(tempLclNum, tempLclType),
+                                                          comp->gtNewIconNode(dominantCase, tempLclType));
+                GenTree* gtCaseBranch = comp->gtNewOperNode(GT_JTRUE, TYP_VOID, gtCaseCond);
+                LIR::AsRange(afterDefaultCondBlock).InsertAtEnd(LIR::SeqTree(comp, gtCaseBranch));
+
+                unsigned remainingWeight = (afterDefaultCondBlock->bbWeight > dominantTarget->bbWeight)
+                                               ? (afterDefaultCondBlock->bbWeight - dominantTarget->bbWeight)
+                                               : BB_ZERO_WEIGHT;
+                switchBlock->setBBProfileWeight(remainingWeight);
+                if (remainingWeight == BB_ZERO_WEIGHT)
+                {
+                    switchBlock->bbFlags |= BBF_RUN_RARELY;
+                }
+            }
+        }
+
+        // Both switch variants need the switch value so create the necessary LclVar node here.
         GenTree*    switchValue      = comp->gtNewLclvNode(tempLclNum, tempLclType);
-        LIR::Range& switchBlockRange = LIR::AsRange(afterDefaultCondBlock);
+        LIR::Range& switchBlockRange = LIR::AsRange(switchBlock);
         switchBlockRange.InsertAtEnd(switchValue);
 
         // Try generating a bit test based switch first,
         // if that's not possible a jump table based switch will be generated.
-        if (!TryLowerSwitchToBitTest(jumpTab, jumpCnt, targetCnt, afterDefaultCondBlock, switchValue))
+        if (!TryLowerSwitchToBitTest(jumpTab, jumpCnt, targetCnt, switchBlock, switchValue))
         {
             JITDUMP("Lowering switch " FMT_BB ": using jump table expansion\n", originalSwitchBB->bbNum);
 
@@ -771,10 +823,10 @@ GenTree* Lowering::LowerSwitch(GenTree* node)
             switchBlockRange.InsertAfter(switchValue, switchTable, switchJump);
 
             // this block no longer branches to the default block
-            afterDefaultCondBlock->bbJumpSwt->removeDefault();
+            switchBlock->bbJumpSwt->removeDefault();
         }
 
-        comp->fgInvalidateSwitchDescMapEntry(afterDefaultCondBlock);
+        comp->fgInvalidateSwitchDescMapEntry(switchBlock);
     }
 
     GenTree* next = node->gtNext;
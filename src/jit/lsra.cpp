@@ -1286,8 +1286,8 @@ void LinearScan::recordVarLocationsAtStartOfBB(BasicBlock* bb)
     VarToRegMap map   = getInVarToRegMap(bb->bbNum);
     unsigned    count = 0;
 
-    VarSetOps::AssignNoCopy(compiler, currentLiveVars,
-                            VarSetOps::Intersection(compiler, registerCandidateVars, bb->bbLiveIn));
+    VarSetOps::Assign(compiler, currentLiveVars, bb->bbLiveIn);
+    VarSetOps::IntersectionD(compiler, currentLiveVars, registerCandidateVars);
     VarSetOps::Iter iter(compiler, currentLiveVars);
     unsigned        varIndex = 0;
     while (iter.NextElem(&varIndex))
@@ -4754,12 +4754,12 @@ void LinearScan::processBlockStartLocations(BasicBlock* currentBlock)
         predVarToRegMap = inVarToRegMap;
     }
 
-    VarSetOps::AssignNoCopy(compiler, currentLiveVars,
-                            VarSetOps::Intersection(compiler, registerCandidateVars, currentBlock->bbLiveIn));
+    VarSetOps::Assign(compiler, currentLiveVars, currentBlock->bbLiveIn);
+    VarSetOps::IntersectionD(compiler, currentLiveVars, registerCandidateVars);
 #ifdef DEBUG
     if (getLsraExtendLifeTimes())
     {
-        VarSetOps::AssignNoCopy(compiler, currentLiveVars, registerCandidateVars);
+        VarSetOps::Assign(compiler, currentLiveVars, registerCandidateVars);
     }
     // If we are rotating register assignments at block boundaries, we want to make the
     // inactive registers available for the rotation.
@@ -4997,8 +4997,8 @@ void LinearScan::processBlockEndLocations(BasicBlock* currentBlock)
     assert(currentBlock != nullptr && currentBlock->bbNum == curBBNum);
     VarToRegMap outVarToRegMap = getOutVarToRegMap(curBBNum);
 
-    VarSetOps::AssignNoCopy(compiler, currentLiveVars,
-                            VarSetOps::Intersection(compiler, registerCandidateVars, currentBlock->bbLiveOut));
+    VarSetOps::Assign(compiler, currentLiveVars, currentBlock->bbLiveOut);
+    VarSetOps::IntersectionD(compiler, currentLiveVars, registerCandidateVars);
 #ifdef DEBUG
     if (getLsraExtendLifeTimes())
     {
@@ -2065,6 +2065,12 @@ void LinearScan::buildIntervals()
     // the first block).
     VarSetOps::AssignNoCopy(compiler, currentLiveVars, VarSetOps::MakeEmpty(compiler));
 
+    // Scratch sets used while processing each block. They are allocated on first use and then
+    // reused for every block so that methods with many tracked locals don't allocate new sets
+    // for each block.
+    VARSET_TP newLiveIn(VarSetOps::UninitVal());
+    VARSET_TP expUseSet(VarSetOps::UninitVal());
+
     for (block = startBlockSequence(); block != nullptr; block = moveToNextBlock())
     {
         JITDUMP("\nNEW BLOCK " FMT_BB "\n", block->bbNum);
@@ -2082,8 +2088,8 @@ void LinearScan::buildIntervals()
 
         if (enregisterLocalVars)
         {
-            VarSetOps::AssignNoCopy(compiler, currentLiveVars,
-                                    VarSetOps::Intersection(compiler, registerCandidateVars, block->bbLiveIn));
+            VarSetOps::Assign(compiler, currentLiveVars, block->bbLiveIn);
+            VarSetOps::IntersectionD(compiler, currentLiveVars, registerCandidateVars);
 
             if (block == compiler->fgFirstBB)
             {
@@ -2103,7 +2109,7 @@ void LinearScan::buildIntervals()
             // TODO-CQ: Consider how best to tune this.  Currently, if we create DummyDefs for uninitialized
             // variables (which may actually be initialized along the dynamically executed paths, but not
             // on all static paths), we wind up with excessive liveranges for some of these variables.
-            VARSET_TP newLiveIn(VarSetOps::MakeCopy(compiler, currentLiveVars));
+            VarSetOps::Assign(compiler, newLiveIn, currentLiveVars);
             if (predBlock)
             {
                 // Compute set difference: newLiveIn = currentLiveVars - predBlock->bbLiveOut
@@ -2224,7 +2230,7 @@ void LinearScan::buildIntervals()
                 // Note that a block ending with GT_JMP has no successors and hence the variables
                 // for which dummy use ref positions are added are arguments of the method.
 
-                VARSET_TP expUseSet(VarSetOps::MakeCopy(compiler, block->bbLiveOut));
+                VarSetOps::Assign(compiler, expUseSet, block->bbLiveOut);
                 VarSetOps::IntersectionD(compiler, expUseSet, registerCandidateVars);
                 BasicBlock* nextBlock = getNextBlock();
                 if (nextBlock != nullptr)
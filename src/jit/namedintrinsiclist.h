@@ -18,6 +18,9 @@ enum NamedIntrinsic : unsigned short
     NI_System_MathF_Round,
     NI_System_Collections_Generic_EqualityComparer_get_Default,
     NI_System_Buffers_Binary_BinaryPrimitives_ReverseEndianness,
+    NI_System_Numerics_BitOperations_LeadingZeroCount,
+    NI_System_Numerics_BitOperations_PopCount,
+    NI_System_Numerics_BitOperations_TrailingZeroCount,
 
 #ifdef FEATURE_HW_INTRINSICS
     NI_IsSupported_True,
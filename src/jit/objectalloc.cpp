@@ -639,6 +639,8 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
 
             case GT_EQ:
             case GT_NE:
+            case GT_NULLCHECK:
+                // Comparing or null-checking the object doesn't make it escaping.
                 canLclVarEscapeViaParentStack = false;
                 break;
 
@@ -747,6 +749,7 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
 
             case GT_EQ:
             case GT_NE:
+            case GT_NULLCHECK:
                 break;
 
             case GT_COMMA:
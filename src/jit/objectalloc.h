@@ -122,7 +122,7 @@ inline void ObjectAllocator::EnableObjectStackAllocation()
 //    Returns true iff local variable can be allocated on the stack.
 //
 // Notes:
-//    Stack allocation of objects with gc fields and boxed objects is currently disabled.
+//    Stack allocation of boxed objects is currently disabled.
 
 inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd)
 {
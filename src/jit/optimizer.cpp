@@ -4533,8 +4533,9 @@ void Compiler::optOptimizeLoops()
 //     for each optimization candidate. Checks if the loop stride is "> 0" if the loop
 //     condition is "less than". If the initializer is "var" init then adds condition
 //     "var >= 0", and if the loop is var limit then, "var >= 0" and "var <= a.len"
-//     are added to "context". These conditions are checked in the pre-header block
-//     and the cloning choice is made.
+//     are added to "context". For a "less than or equal" loop the last iteration
+//     accesses "a[var]", so "var < a.len" is used instead. These conditions are
+//     checked in the pre-header block and the cloning choice is made.
 //
 // Assumption:
 //      Callers should assume AND operation is used i.e., if all conditions are
@@ -4548,8 +4549,13 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
     LoopDsc*                         loop     = &optLoopTable[loopNum];
     JitExpandArrayStack<LcOptInfo*>* optInfos = context->GetLoopOptInfo(loopNum);
 
-    if (loop->lpTestOper() == GT_LT)
+    const genTreeOps testOper = loop->lpTestOper();
+
+    if ((testOper == GT_LT) || (testOper == GT_LE))
     {
+        // For "i < limit" the limit may equal the array length, for "i <= limit" it must be below it.
+        const genTreeOps limitOper = (testOper == GT_LT) ? GT_LE : GT_LT;
+
         // Stride conditions
         if (loop->lpIterConst() <= 0)
         {
@@ -4603,6 +4609,12 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
         }
         else if (loop->lpFlags & LPFLG_ARRLEN_LIMIT)
         {
+            if (testOper == GT_LE)
+            {
+                JITDUMP("> ArrLen limit with <= always accesses out of bounds\n");
+                return false;
+            }
+
             ArrIndex* index = new (getAllocator()) ArrIndex(getAllocator());
             if (!loop->lpArrLenLimit(this, index))
             {
@@ -4628,12 +4640,12 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
             {
                 case LcOptInfo::LcJaggedArray:
                 {
-                    // limit <= arrLen
+                    // limit <= arrLen (or limit < arrLen)
                     LcJaggedArrayOptInfo* arrIndexInfo = optInfo->AsLcJaggedArrayOptInfo();
                     LC_Array arrLen(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::ArrLen);
                     LC_Ident arrLenIdent = LC_Ident(arrLen);
 
-                    LC_Condition cond(GT_LE, LC_Expr(ident), LC_Expr(arrLenIdent));
+                    LC_Condition cond(limitOper, LC_Expr(ident), LC_Expr(arrLenIdent));
                     context->EnsureConditions(loopNum)->Push(cond);
 
                     // Ensure that this array must be dereference-able, before executing the actual condition.
@@ -4643,9 +4655,9 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
                 break;
                 case LcOptInfo::LcMdArray:
                 {
-                    // limit <= mdArrLen
+                    // limit <= mdArrLen (or limit < mdArrLen)
                     LcMdArrayOptInfo* mdArrInfo = optInfo->AsLcMdArrayOptInfo();
-                    LC_Condition      cond(GT_LE, LC_Expr(ident),
+                    LC_Condition      cond(limitOper, LC_Expr(ident),
                                       LC_Expr(LC_Ident(LC_Array(LC_Array::MdArray,
                                                                 mdArrInfo->GetArrIndexForDim(getAllocator()),
                                                                 mdArrInfo->dim, LC_Array::None))));
@@ -517,6 +517,16 @@ HRESULT ImportHelper::FindStandAloneSig(
     _ASSERTE(cbSig &&  psa);
     *psa = mdSignatureNil;
 
+    RID rid;
+    hr = pMiniMd->FindSignatureFromHash(TBL_StandAloneSig, pbSig, cbSig, &rid);
+    if (hr == S_OK)
+    {
+        *psa = TokenFromRid(rid, mdtSignature);
+        return S_OK;
+    }
+    if (hr != S_FALSE)
+        return hr;
+
     cRecs = pMiniMd->getCountStandAloneSigs();
 
     // Search for the StandAloneSignature
@@ -556,6 +566,16 @@ ImportHelper::FindTypeSpec(
     _ASSERTE(pTypeSpec != NULL);
     *pTypeSpec = mdSignatureNil;
 
+    RID rid;
+    hr = pMiniMd->FindSignatureFromHash(TBL_TypeSpec, pbSig, cbSig, &rid);
+    if (hr == S_OK)
+    {
+        *pTypeSpec = TokenFromRid(rid, mdtTypeSpec);
+        return S_OK;
+    }
+    if (hr != S_FALSE)
+        return hr;
+
     cRecs = pMiniMd->getCountTypeSpecs();
 
     // Search for the TypeSpec
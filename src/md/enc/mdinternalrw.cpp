@@ -2057,12 +2057,13 @@ HRESULT MDInternalRW::FindTypeRefByName(  // S_OK or error.
         else if (tkRes != tkResolutionScope)
             continue;
 
-        IfFailGo(m_pStgdb->m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespaceTmp));
-        if (strcmp(szNamespace, szNamespaceTmp))
+        // Compare the name first, it is far more selective than the namespace.
+        IfFailGo(m_pStgdb->m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szNameTmp));
+        if (strcmp(szNameTmp, szName))
             continue;
 
-        IfFailGo(m_pStgdb->m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szNameTmp));
-        if (!strcmp(szNameTmp, szName))
+        IfFailGo(m_pStgdb->m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespaceTmp));
+        if (!strcmp(szNamespace, szNamespaceTmp))
         {
             *ptk = TokenFromRid(i, mdtTypeRef);
             goto ErrExit;
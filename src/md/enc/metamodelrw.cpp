@@ -656,6 +656,10 @@ CMiniMdRW::CMiniMdRW()
  :  m_pMemberRefHash(0),
     m_pMemberDefHash(0),
     m_pNamedItemHash(0),
+    m_pTypeSpecHash(0),
+    m_pStandAloneSigHash(0),
+    m_cTypeSpecHashed(0),
+    m_cStandAloneSigHashed(0),
     m_pHandler(0),
     m_cbSaveSize(0),
     m_fIsReadOnly(false),
@@ -759,6 +763,10 @@ CMiniMdRW::~CMiniMdRW()
         delete m_pMemberDefHash;
     if (m_pNamedItemHash)
         delete m_pNamedItemHash;
+    if (m_pTypeSpecHash)
+        delete m_pTypeSpecHash;
+    if (m_pStandAloneSigHash)
+        delete m_pStandAloneSigHash;
     if (m_pMethodMap)
         delete m_pMethodMap;
     if (m_pFieldMap)
@@ -7645,6 +7653,126 @@ CMiniMdRW::FindNamedItemFromHash(
     }
 } // CMiniMdRW::FindNamedItemFromHash
 
+//*****************************************************************************
+// Get the signature of a TypeSpec or StandAloneSig row.
+//*****************************************************************************
+__checkReturn 
+HRESULT 
+CMiniMdRW::GetSignatureOfHashedItem(
+    ULONG            ixTbl,     // TBL_TypeSpec or TBL_StandAloneSig.
+    RID              rid,       // Row to get the signature of.
+    PCCOR_SIGNATURE *ppbSig,    // [OUT] Signature.
+    ULONG           *pcbSig)    // [OUT] Size of signature.
+{
+    HRESULT hr;
+
+    if (ixTbl == TBL_TypeSpec)
+    {
+        TypeSpecRec *pRec;
+        IfFailRet(GetTypeSpecRecord(rid, &pRec));
+        IfFailRet(getSignatureOfTypeSpec(pRec, ppbSig, pcbSig));
+    }
+    else
+    {
+        _ASSERTE(ixTbl == TBL_StandAloneSig);
+        StandAloneSigRec *pRec;
+        IfFailRet(GetStandAloneSigRecord(rid, &pRec));
+        IfFailRet(getSignatureOfStandAloneSig(pRec, ppbSig, pcbSig));
+    }
+    return S_OK;
+} // CMiniMdRW::GetSignatureOfHashedItem
+
+//*****************************************************************************
+// Search for a TypeSpec or StandAloneSig by signature.  The hash is built once
+//  the table passes INDEX_ROW_COUNT_THRESHOLD and rows appended since the last
+//  search are added to it first.  Returns S_FALSE if there is no hash, in which
+//  case the caller scans the table.
+//*****************************************************************************
+__checkReturn 
+HRESULT 
+CMiniMdRW::FindSignatureFromHash(
+    ULONG           ixTbl,      // TBL_TypeSpec or TBL_StandAloneSig.
+    PCCOR_SIGNATURE pbSig,      // Signature.
+    ULONG           cbSig,      // Size of signature.
+    RID            *pRid)       // Return if found.
+{
+    HRESULT             hr = S_OK;
+    CMetaDataHashBase **ppHash;
+    ULONG              *pcHashed;
+    TOKENHASHENTRY     *pEntry;
+    PCCOR_SIGNATURE     pbSigTmp;
+    ULONG               cbSigTmp;
+    int                 pos;
+
+    _ASSERTE((ixTbl == TBL_TypeSpec) || (ixTbl == TBL_StandAloneSig));
+
+    if (ixTbl == TBL_TypeSpec)
+    {
+        ppHash = &m_pTypeSpecHash;
+        pcHashed = &m_cTypeSpecHashed;
+    }
+    else
+    {
+        ppHash = &m_pStandAloneSigHash;
+        pcHashed = &m_cStandAloneSigHashed;
+    }
+
+    ULONG ridEnd = GetCountRecs(ixTbl);
+
+    // Rows are only ever appended; if the table shrank, start over.
+    if ((*ppHash != NULL) && (ridEnd < *pcHashed))
+    {
+        delete *ppHash;
+        *ppHash = NULL;
+        *pcHashed = 0;
+    }
+
+    if (*ppHash == NULL)
+    {
+        // Range check avoiding prefast warning with:  "if (ridEnd + 1 > INDEX_ROW_COUNT_THRESHOLD)"
+        if (ridEnd <= (INDEX_ROW_COUNT_THRESHOLD - 1))
+            return S_FALSE;
+
+        NewHolder<CMetaDataHashBase> pHash = new (nothrow) CMetaDataHashBase;
+        IfNullGo(pHash);
+        IfFailGo(pHash->NewInit(
+            g_HashSize[GetMetaDataSizeIndex(&m_OptionValue)]));
+        *ppHash = pHash.Extract();
+        *pcHashed = 0;
+    }
+
+    // Add the rows appended since the last search.
+    for (ULONG index = *pcHashed + 1; index <= ridEnd; index++)
+    {
+        IfFailGo(GetSignatureOfHashedItem(ixTbl, index, &pbSigTmp, &cbSigTmp));
+        pEntry = (*ppHash)->Add(HashBytes(pbSigTmp, cbSigTmp));
+        IfNullGo(pEntry);
+        pEntry->tok = TokenFromRid(index, (ixTbl == TBL_TypeSpec) ? mdtTypeSpec : mdtSignature);
+        *pcHashed = index;
+    }
+
+    // Go through every entry in the hash chain looking for ours.  If the table
+    //  holds duplicates, return the first one, as a linear scan would.
+    hr = CLDB_E_RECORD_NOTFOUND;
+    for (pEntry = (*ppHash)->FindFirst(HashBytes(pbSig, cbSig), pos); 
+         pEntry != NULL; 
+         pEntry = (*ppHash)->FindNext(pos))
+    {
+        RID rid = RidFromToken(pEntry->tok);
+        if ((hr == S_OK) && (rid >= *pRid))
+            continue;
+        IfFailGo(GetSignatureOfHashedItem(ixTbl, rid, &pbSigTmp, &cbSigTmp));
+        if ((cbSigTmp == cbSig) && (memcmp(pbSig, pbSigTmp, cbSig) == 0))
+        {
+            *pRid = rid;
+            hr = S_OK;
+        }
+    }
+
+ErrExit:
+    return hr;
+} // CMiniMdRW::FindSignatureFromHash
+
 //*****************************************************************************
 // Check a given mr token to see if this one is a match.
 //*****************************************************************************
@@ -822,6 +822,30 @@ public:
 
     CMetaDataHashBase *m_pNamedItemHash;
 
+    //*************************************************************************
+    // Hash for items identified only by their signature (TypeSpec, StandAloneSig).
+    // Rows added since the last search are hashed lazily, so it does not matter
+    //  which code path appended them.
+    //*************************************************************************
+    __checkReturn 
+    HRESULT FindSignatureFromHash(          // S_OK found, CLDB_E_RECORD_NOTFOUND, or S_FALSE if no hash.
+        ULONG           ixTbl,              // TBL_TypeSpec or TBL_StandAloneSig.
+        PCCOR_SIGNATURE pbSig,              // Signature.
+        ULONG           cbSig,              // Size of signature.
+        RID            *pRid);              // Return if found.
+
+    __checkReturn 
+    HRESULT GetSignatureOfHashedItem(
+        ULONG           ixTbl,              // TBL_TypeSpec or TBL_StandAloneSig.
+        RID             rid,                // Row to get the signature of.
+        PCCOR_SIGNATURE *ppbSig,            // [OUT] Signature.
+        ULONG          *pcbSig);            // [OUT] Size of signature.
+
+    CMetaDataHashBase *m_pTypeSpecHash;
+    CMetaDataHashBase *m_pStandAloneSigHash;
+    ULONG       m_cTypeSpecHashed;          // Rows of TBL_TypeSpec in m_pTypeSpecHash.
+    ULONG       m_cStandAloneSigHashed;     // Rows of TBL_StandAloneSig in m_pStandAloneSigHash.
+
     //*****************************************************************************
     // IMetaModelCommon - RW specific versions for some of the functions.
     //*****************************************************************************
@@ -1176,12 +1176,14 @@ HRESULT MDInternalRO::FindTypeRefByName(  // S_OK or error.
         else if (tkRes != tkResolutionScope)
             continue;
 
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespaceTmp));
-        if (strcmp(szNamespace, szNamespaceTmp))
+        // Compare the name first, as it is far more selective than the namespace, which most
+        // TypeRefs in a scope share with many others.
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szNameTmp));
+        if (strcmp(szNameTmp, szName))
             continue;
 
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szNameTmp));
-        if (!strcmp(szNameTmp, szName))
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespaceTmp));
+        if (!strcmp(szNamespace, szNamespaceTmp))
         {
             *ptk = TokenFromRid(i, mdtTypeRef);
             goto ErrExit;
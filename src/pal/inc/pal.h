@@ -2782,6 +2782,25 @@ PAL_VirtualReserveFromExecutableMemoryAllocatorWithinRange(
     IN LPCVOID lpEndAddress,
     IN SIZE_T dwSize);
 
+/*++
+Function:
+PAL_HasVirtualAdviseLargePages
+
+Checks if PAL_VirtualAdviseLargePages is able to honour the hint in the current environment
+
+--*/
+PALIMPORT
+BOOL
+PALAPI
+PAL_HasVirtualAdviseLargePages(VOID);
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_VirtualAdviseLargePages(
+    IN LPVOID lpAddress,
+    IN SIZE_T dwSize);
+
 PALIMPORT
 LPVOID
 PALAPI
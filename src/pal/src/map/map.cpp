@@ -2202,6 +2202,34 @@ MAPmmapAndRecord(
     return palError;
 }
 
+// Flags of COMPlus_PEImageMapAdvice
+#define PE_MAP_ADVICE_WILLNEED      0x1     // madvise(MADV_WILLNEED) every section to start read-ahead
+#define PE_MAP_ADVICE_HUGEPAGE      0x2     // madvise(MADV_HUGEPAGE) executable sections
+
+/*++
+    MAPGetPEImageMapAdvice -
+
+    Read COMPlus_PEImageMapAdvice once. Like all numeric COMPlus_xxx values it is
+    a hexadecimal string without any prefix.
+--*/
+static DWORD MAPGetPEImageMapAdvice()
+{
+    static DWORD s_advice = (DWORD)-1;
+
+    if (s_advice == (DWORD)-1)
+    {
+        DWORD advice = 0;
+        char* adviceStr = getenv("COMPlus_PEImageMapAdvice");
+        if (adviceStr != NULL)
+        {
+            advice = (DWORD)strtoul(adviceStr, NULL, 16);
+        }
+        s_advice = advice;
+    }
+
+    return s_advice;
+}
+
 /*++
     MAPMapPEFile -
 
@@ -2519,6 +2547,25 @@ void * MAPMapPEFile(HANDLE hFile)
             goto doneReleaseMappingCriticalSection;
         }
 
+        // Advice is only a hint; failures are traced and otherwise ignored.
+        if (MAPGetPEImageMapAdvice() != 0)
+        {
+            size_t adviceSize = (char*)sectionBase + currentHeader.SizeOfRawData - (char*)sectionBaseAligned;
+
+            if ((MAPGetPEImageMapAdvice() & PE_MAP_ADVICE_WILLNEED) &&
+                (-1 == madvise(sectionBaseAligned, adviceSize, MADV_WILLNEED)))
+            {
+                TRACE_(LOADER)("madvise(MADV_WILLNEED) of section %d failed, errno = %d\n", i, errno);
+            }
+#ifdef MADV_HUGEPAGE
+            if ((MAPGetPEImageMapAdvice() & PE_MAP_ADVICE_HUGEPAGE) && (prot & PROT_EXEC) &&
+                (-1 == madvise(sectionBaseAligned, adviceSize, MADV_HUGEPAGE)))
+            {
+                TRACE_(LOADER)("madvise(MADV_HUGEPAGE) of section %d failed, errno = %d\n", i, errno);
+            }
+#endif // MADV_HUGEPAGE
+        }
+
 #if _DEBUG
         {
             // Ensure null termination of section name (which is allowed to not be null terminated if exactly 8 characters long)
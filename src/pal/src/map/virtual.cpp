@@ -52,6 +52,11 @@ CRITICAL_SECTION virtual_critsec;
 // The first node in our list of allocated blocks.
 static PCMI pVirtualMemory;
 
+// The entry VIRTUALFindRegionInformation found last. Commits and decommits tend to
+// hit the same reservation repeatedly, so checking it first avoids walking the list.
+// Protected by virtual_critsec like the list itself.
+static PCMI pVirtualMemoryLastFound;
+
 static size_t s_virtualPageSize = 0;
 
 /* We need MAP_ANON. However on some platforms like HP-UX, it is defined as MAP_ANONYMOUS */
@@ -210,6 +215,7 @@ void VIRTUALCleanup()
         free(pTempEntry );
     }
     pVirtualMemory = NULL;
+    pVirtualMemoryLastFound = NULL;
 
     InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
 
@@ -480,6 +486,13 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
 
     TRACE( "VIRTUALFindRegionInformation( %#x )\n", address );
 
+    pEntry = pVirtualMemoryLastFound;
+    if ( pEntry && ( pEntry->startBoundary <= address ) &&
+         ( pEntry->startBoundary + pEntry->memSize > address ) )
+    {
+        return pEntry;
+    }
+
     pEntry = pVirtualMemory;
 
     while( pEntry )
@@ -492,6 +505,7 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
         }
         if ( pEntry->startBoundary + pEntry->memSize > address )
         {
+            pVirtualMemoryLastFound = pEntry;
             break;
         }
 
@@ -519,6 +533,11 @@ static BOOL VIRTUALReleaseMemory( PCMI pMemoryToBeReleased )
         return FALSE;
     }
 
+    if ( pMemoryToBeReleased == pVirtualMemoryLastFound )
+    {
+        pVirtualMemoryLastFound = NULL;
+    }
+
     if ( pMemoryToBeReleased == pVirtualMemory )
     {
         /* This is either the first entry, or the only entry. */
@@ -1320,6 +1339,56 @@ PAL_VirtualReserveFromExecutableMemoryAllocatorWithinRange(
 #endif // BIT64
 }
 
+/*++
+Function:
+  PAL_HasVirtualAdviseLargePages
+
+  Returns TRUE if PAL_VirtualAdviseLargePages can pass the hint on to the OS.
+--*/
+BOOL
+PALAPI
+PAL_HasVirtualAdviseLargePages()
+{
+#ifdef MADV_HUGEPAGE
+    return TRUE;
+#else // MADV_HUGEPAGE
+    return FALSE;
+#endif // MADV_HUGEPAGE
+}
+
+/*++
+Function:
+  PAL_VirtualAdviseLargePages
+
+  Hints that the pages in the range should be backed by transparent large
+  pages as they get committed. This is only advice; the OS may ignore it.
+  Decommitting a range with VirtualFree drops the advice, so callers need to
+  apply it again afterwards.
+
+  lpAddress - Starting address of the range
+  dwSize - Size of the range in bytes
+--*/
+BOOL
+PALAPI
+PAL_VirtualAdviseLargePages(
+    IN LPVOID lpAddress,
+    IN SIZE_T dwSize)
+{
+    BOOL bRetVal = FALSE;
+
+    ENTRY("PAL_VirtualAdviseLargePages(lpAddress=%p, dwSize=%u)\n", lpAddress, dwSize);
+
+#ifdef MADV_HUGEPAGE
+    UINT_PTR StartBoundary = (UINT_PTR) ALIGN_DOWN(lpAddress, GetVirtualPageSize());
+    SIZE_T MemSize = ALIGN_UP((UINT_PTR)lpAddress + dwSize, GetVirtualPageSize()) - StartBoundary;
+
+    bRetVal = (madvise((LPVOID) StartBoundary, MemSize, MADV_HUGEPAGE) == 0);
+#endif // MADV_HUGEPAGE
+
+    LOGEXIT("PAL_VirtualAdviseLargePages returning %d\n", bRetVal);
+    return bRetVal;
+}
+
 /*++
 Function:
   VirtualAlloc
@@ -512,6 +512,14 @@ ReadMemoryValueFromFile(const char* filename, uint64_t* val)
     if (getline(&line, &lineLen, file) == -1)
         goto done;
 
+    // cgroup v2 uses "max" for no limit
+    if (strncmp(line, "max", 3) == 0)
+    {
+        *val = _UI64_MAX;
+        result = true;
+        goto done;
+    }
+
     errno = 0;
     num = strtoull(line, &endptr, 0);
     if (errno != 0)
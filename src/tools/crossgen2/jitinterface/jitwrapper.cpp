@@ -27,11 +27,11 @@ private:
     uint64_t corJitFlags;
 };
 
-static const GUID JITEEVersionIdentifier = { /* aec2498a-ca70-408e-903e-1e6d84e90bd2 */
-    0xaec2498a,
-    0xca70,
-    0x408e,
-    {0x90, 0x3e, 0x1e, 0x6d, 0x84, 0xe9, 0x0b, 0xd2}
+static const GUID JITEEVersionIdentifier = { /* 0d7c4a1b-86e3-4b5f-a2c9-7f31e85b94d6 */
+    0x0d7c4a1b,
+    0x86e3,
+    0x4b5f,
+    {0xa2, 0xc9, 0x7f, 0x31, 0xe8, 0x5b, 0x94, 0xd6}
 };
 
 class Jit
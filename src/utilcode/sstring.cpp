@@ -2591,6 +2591,25 @@ BOOL SString::ScanASCII() const
     {
         const CHAR *c = GetRawANSI();
         const CHAR *cEnd = c + GetRawCount();
+
+        // Check a machine word at a time once the pointer is aligned; any byte with
+        // the high bit set ends the fast path and the byte loop below finds it.
+        const size_t highBits = ((size_t)-1 / 0xFF) * 0x80;
+        while (c < cEnd && ((size_t)c & (sizeof(size_t) - 1)) != 0)
+        {
+            if (*c & 0x80)
+                break;
+            c++;
+        }
+        if (((size_t)c & (sizeof(size_t) - 1)) == 0)
+        {
+            while ((size_t)(cEnd - c) >= sizeof(size_t))
+            {
+                if (*(const size_t *)c & highBits)
+                    break;
+                c += sizeof(size_t);
+            }
+        }
         while (c < cEnd)
         {
             if (*c & 0x80)
@@ -906,7 +906,11 @@ DomainAssembly *AssemblySpec::LoadDomainAssembly(FileLoadLevel targetLevel,
     }
     CONTRACT_END;
 
+#ifndef FEATURE_PAL
+    // Runs for every assembly load, including binding cache hits, so like the
+    // prestub span this is only traced on Windows.
     ETWOnStartup (LoaderCatchCall_V1, LoaderCatchCallEnd_V1);
+#endif // !FEATURE_PAL
     AppDomain* pDomain = GetAppDomain();
 
     DomainAssembly* pAssembly = nullptr;
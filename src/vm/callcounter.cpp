@@ -80,6 +80,33 @@ void CallCounter::DisableCallCounting(MethodDesc* pMethodDesc)
     m_methodToCallCount.Add(CallCounterEntry::CreateWithCallCountingDisabled(pMethodDesc));
 }
 
+void CallCounter::ReduceCallCountThreshold(MethodDesc* pMethodDesc, int callCountThreshold)
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(pMethodDesc != NULL);
+    _ASSERTE(pMethodDesc->IsEligibleForTieredCompilation());
+    _ASSERTE(callCountThreshold >= 1);
+
+    SpinLockHolder holder(&m_lock);
+
+    CallCounterEntry *existingEntry = const_cast<CallCounterEntry *>(m_methodToCallCount.LookupPtr(pMethodDesc));
+    if (existingEntry != nullptr)
+    {
+        // The call that triggered jitting has already been counted. A limit of 0 is only observed by IncrementCount() upon
+        // decrementing, so the earliest that the method can be promoted from here is on its next call.
+        if (existingEntry->IsCallCountingEnabled() && existingEntry->callCountLimit > callCountThreshold - 1)
+        {
+            existingEntry->callCountLimit = max(callCountThreshold - 1, 1);
+        }
+        return;
+    }
+
+    // With multi-core JIT, a function may be jitted before it is called, in which case none of its calls have been counted yet
+    CallCounterEntry entry(pMethodDesc, callCountThreshold);
+    entry.startTickCount = GetTickCount();
+    m_methodToCallCount.Add(entry);
+}
+
 NOINLINE bool CallCounter::OnMethodCodeVersionCalledSubsequently(NativeCodeVersion nativeCodeVersion, bool *doPublishRef)
 {
     STANDARD_VM_CONTRACT;
@@ -138,6 +165,7 @@ bool CallCounter::IncrementCount(MethodDesc* pMethodDesc)
     // the size of the jitted code.
 
     int callCountLimit;
+    bool isCalledFrequently = false;
     {
         //Be careful if you convert to something fully lock/interlocked-free that
         //you correctly handle what happens when some N simultaneous calls don't
@@ -149,13 +177,21 @@ bool CallCounter::IncrementCount(MethodDesc* pMethodDesc)
         CallCounterEntry* pEntry = const_cast<CallCounterEntry*>(m_methodToCallCount.LookupPtr(pMethodDesc));
         if (pEntry == NULL)
         {
-            callCountLimit = (int)g_pConfig->TieredCompilation_CallCountThreshold() - 1;
+            callCountLimit = (int)GetAppDomain()->GetTieredCompilationManager()->GetCallCountThreshold() - 1;
             _ASSERTE(callCountLimit >= 0);
-            m_methodToCallCount.Add(CallCounterEntry(pMethodDesc, callCountLimit));
+            CallCounterEntry entry(pMethodDesc, callCountLimit);
+            entry.startTickCount = GetTickCount();
+            m_methodToCallCount.Add(entry);
+            isCalledFrequently = true;
         }
         else if (pEntry->IsCallCountingEnabled())
         {
             callCountLimit = --pEntry->callCountLimit;
+            if (callCountLimit == 0)
+            {
+                isCalledFrequently =
+                    GetTickCount() - pEntry->startTickCount <= TieredCompilationManager::FrequentlyCalledMethodCountingDurationMs;
+            }
         }
         else
         {
@@ -169,7 +205,7 @@ bool CallCounter::IncrementCount(MethodDesc* pMethodDesc)
     }
     if (callCountLimit == 0)
     {
-        GetAppDomain()->GetTieredCompilationManager()->AsyncPromoteMethodToTier1(pMethodDesc);
+        GetAppDomain()->GetTieredCompilationManager()->AsyncPromoteMethodToTier1(pMethodDesc, isCalledFrequently);
     }
     return false; // stop counting calls
 }
@@ -18,10 +18,11 @@ struct CallCounterEntry
 {
     CallCounterEntry() {}
     CallCounterEntry(PTR_MethodDesc m, const int callCountLimit)
-        : pMethod(m), callCountLimit(callCountLimit) {}
+        : pMethod(m), callCountLimit(callCountLimit), startTickCount(0) {}
 
     PTR_MethodDesc pMethod;
     int callCountLimit;
+    DWORD startTickCount; // when call counting began for the method, used to prioritize methods that are called frequently
 
 #ifndef DACCESS_COMPILE
     static CallCounterEntry CreateWithCallCountingDisabled(MethodDesc *m);
@@ -93,6 +94,7 @@ public:
     bool IsCallCountingEnabled(PTR_MethodDesc pMethodDesc);
 #ifndef DACCESS_COMPILE
     void DisableCallCounting(MethodDesc* pMethodDesc);
+    void ReduceCallCountThreshold(MethodDesc* pMethodDesc, int callCountThreshold);
 #endif
 
     static bool OnMethodCodeVersionCalledSubsequently(NativeCodeVersion nativeCodeVersion, bool *doPublishRef);
@@ -5022,7 +5022,10 @@ DomainAssembly * Module::LoadAssembly(
     }
     CONTRACT_END;
 
+#ifndef FEATURE_PAL
+    // Every assembly ref resolution goes through here; see AssemblySpec::LoadDomainAssembly.
     ETWOnStartup (LoaderCatchCall_V1, LoaderCatchCallEnd_V1);
+#endif // !FEATURE_PAL
 
     DomainAssembly * pDomainAssembly;
 
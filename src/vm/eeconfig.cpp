@@ -336,7 +336,10 @@ HRESULT EEConfig::Init()
     fTieredCompilation_QuickJitForLoops = false;
     fTieredCompilation_CallCounting = false;
     tieredCompilation_CallCountThreshold = 1;
+    tieredCompilation_CallCountThresholdForLoops = 1;
     tieredCompilation_CallCountingDelayMs = 0;
+    tieredCompilation_BackgroundWorkerCount = 1;
+    fTieredCompilation_BlockCounting = false;
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -1213,6 +1216,17 @@ fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_
             tieredCompilation_CallCountThreshold = INT_MAX;
         }
 
+        tieredCompilation_CallCountThresholdForLoops =
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCountThresholdForLoops);
+        if (tieredCompilation_CallCountThresholdForLoops < 1)
+        {
+            tieredCompilation_CallCountThresholdForLoops = 1;
+        }
+        else if (tieredCompilation_CallCountThresholdForLoops > tieredCompilation_CallCountThreshold)
+        {
+            tieredCompilation_CallCountThresholdForLoops = tieredCompilation_CallCountThreshold;
+        }
+
         tieredCompilation_CallCountingDelayMs = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCountingDelayMs);
 
 #ifndef FEATURE_PAL
@@ -1233,6 +1247,21 @@ fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_
             }
         }
 
+        tieredCompilation_BackgroundWorkerCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerCount);
+        if (tieredCompilation_BackgroundWorkerCount < 1)
+        {
+            tieredCompilation_BackgroundWorkerCount = 1;
+        }
+        else if (tieredCompilation_BackgroundWorkerCount > (DWORD)GetCurrentProcessCpuCount())
+        {
+            tieredCompilation_BackgroundWorkerCount = (DWORD)GetCurrentProcessCpuCount();
+        }
+
+        if (fTieredCompilation_QuickJit && fTieredCompilation_CallCounting)
+        {
+            fTieredCompilation_BlockCounting = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_BlockCounting) != 0;
+        }
+
         if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
         {
             ETW::CompilationLog::TieredCompilation::Runtime::SendSettings();
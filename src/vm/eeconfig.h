@@ -285,7 +285,10 @@ public:
     bool          TieredCompilation_QuickJitForLoops() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJitForLoops; }
     bool          TieredCompilation_CallCounting()  const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCounting; }
     DWORD         TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
+    DWORD         TieredCompilation_CallCountThresholdForLoops() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThresholdForLoops; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
+    DWORD         TieredCompilation_BackgroundWorkerCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerCount; }
+    bool          TieredCompilation_BlockCounting() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_BlockCounting; }
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -1020,7 +1023,10 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_QuickJitForLoops;
     bool fTieredCompilation_CallCounting;
     DWORD tieredCompilation_CallCountThreshold;
+    DWORD tieredCompilation_CallCountThresholdForLoops;
     DWORD tieredCompilation_CallCountingDelayMs;
+    DWORD tieredCompilation_BackgroundWorkerCount;
+    bool fTieredCompilation_BlockCounting;
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -90,6 +90,68 @@ bool EventPipeBufferManager::IsLockOwnedByCurrentThread()
 }
 #endif
 
+// Pick a buffer size for a thread that already owns bufferCount buffers, given the
+// size of the event that has to fit and the space left under the session's limit.
+static unsigned int GetBufferSizeForThread(unsigned int bufferCount, unsigned int requestSize, size_t availableBufferSize)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Pick a buffer size by multiplying the base buffer size by the number of buffers already allocated for this thread.
+    unsigned int sizeMultiplier = bufferCount + 1;
+
+    // Pick the base buffer size based.  Debug builds have a smaller size to stress the allocate/steal path more.
+    unsigned int baseBufferSize =
+#ifdef _DEBUG
+        30 * 1024; // 30K
+#else
+        100 * 1024; // 100K
+#endif
+    unsigned int bufferSize = baseBufferSize * sizeMultiplier;
+
+    // Make sure that buffer size >= request size so that the buffer size does not
+    // determine the max event size.
+    _ASSERTE(requestSize <= availableBufferSize);
+    bufferSize = Max(requestSize, bufferSize);
+    bufferSize = Min((unsigned int)bufferSize, (unsigned int)availableBufferSize);
+
+    // Don't allow the buffer size to exceed 1MB.
+    const unsigned int maxBufferSize = 1024 * 1024;
+    bufferSize = Min(bufferSize, maxBufferSize);
+
+    return bufferSize;
+}
+
+static EventPipeBuffer* NewEventPipeBuffer(EventPipeThreadSessionState* pSessionState, unsigned int bufferSize)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    EventPipeBuffer *pNewBuffer = NULL;
+
+    // EX_TRY is used here as opposed to new (nothrow) because
+    // the constructor also allocates a private buffer, which
+    // could throw, and cannot be easily checked
+    EX_TRY
+    {
+        // The sequence counter is exclusively mutated on this thread so this is a thread-local
+        // read.
+        unsigned int sequenceNumber = pSessionState->GetVolatileSequenceNumber();
+        pNewBuffer = new EventPipeBuffer(bufferSize, pSessionState->GetThread(), sequenceNumber);
+    }
+    EX_CATCH
+    {
+        pNewBuffer = NULL;
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    return pNewBuffer;
+}
+
 EventPipeBuffer* EventPipeBufferManager::AllocateBufferForThread(EventPipeThreadSessionState* pSessionState,
                                                                  unsigned int requestSize,
                                                                  BOOL & writeSuspended)
@@ -104,17 +166,70 @@ EventPipeBuffer* EventPipeBufferManager::AllocateBufferForThread(EventPipeThread
     }
     CONTRACTL_END;
 
-    // Allocating a buffer requires us to take the lock.
-    SpinLockHolder _slh(&m_lock);
+    // Allocating and zeroing the buffer memory is the expensive part of this function, so do it
+    // before taking the lock, based on an unsynchronized guess of the size the policy below will pick.
+    // The guess is only used if it matches; otherwise the buffer is allocated under the lock as before.
+    EventPipeBuffer *pPreallocatedBuffer = NULL;
+    unsigned int preallocatedBufferSize = 0;
+    {
+        EventPipeBufferList *pThreadBufferList = pSessionState->GetBufferList();
+        unsigned int bufferCount = (pThreadBufferList != NULL) ? pThreadBufferList->GetCount() : 0;
+        size_t sizeOfAllBuffers = VolatileLoadWithoutBarrier(&m_sizeOfAllBuffers);
+        if (sizeOfAllBuffers <= m_maxSizeOfAllBuffers)
+        {
+            size_t availableBufferSize = m_maxSizeOfAllBuffers - sizeOfAllBuffers;
+            if (requestSize <= availableBufferSize)
+            {
+                preallocatedBufferSize = GetBufferSizeForThread(bufferCount, requestSize, availableBufferSize);
+                pPreallocatedBuffer = NewEventPipeBuffer(pSessionState, preallocatedBufferSize);
+            }
+        }
+    }
+
+    EventPipeBuffer *pNewBuffer = NULL;
+    {
+        // Committing a buffer requires us to take the lock.
+        SpinLockHolder _slh(&m_lock);
+
+        // if we are deallocating then give up, see the comments in SuspendWriteEvents() for why this is important.
+        if (m_writeEventSuspending.Load())
+        {
+            writeSuspended = TRUE;
+        }
+        else
+        {
+            pNewBuffer = AllocateBufferForThreadHaveLock(pSessionState, requestSize, pPreallocatedBuffer, preallocatedBufferSize);
+        }
+    }
 
-    // if we are deallocating then give up, see the comments in SuspendWriteEvents() for why this is important.
-    if (m_writeEventSuspending.Load())
+    // Free the speculative allocation outside of the lock if it wasn't used.
+    if (pPreallocatedBuffer != NULL && pPreallocatedBuffer != pNewBuffer)
     {
-        writeSuspended = TRUE;
-        return NULL;
+        {
+            SpinLockHolder _slh(pSessionState->GetThread()->GetLock());
+            pPreallocatedBuffer->ConvertToReadOnly();
+        }
+        delete pPreallocatedBuffer;
     }
 
-    bool allocateNewBuffer = false;
+    return pNewBuffer;
+}
+
+EventPipeBuffer* EventPipeBufferManager::AllocateBufferForThreadHaveLock(EventPipeThreadSessionState* pSessionState,
+                                                                         unsigned int requestSize,
+                                                                         EventPipeBuffer* pPreallocatedBuffer,
+                                                                         unsigned int preallocatedBufferSize)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        PRECONDITION(pSessionState != NULL);
+        PRECONDITION(requestSize > 0);
+        PRECONDITION(m_lock.OwnedByCurrentThread());
+    }
+    CONTRACTL_END;
 
     EventPipeBufferList *pThreadBufferList = pSessionState->GetBufferList();
     if (pThreadBufferList == NULL)
@@ -138,89 +253,53 @@ EventPipeBuffer* EventPipeBufferManager::AllocateBufferForThread(EventPipeThread
 
     // Determine if policy allows us to allocate another buffer
     size_t availableBufferSize = m_maxSizeOfAllBuffers - m_sizeOfAllBuffers;
-    if (requestSize <= availableBufferSize)
+    if (requestSize > availableBufferSize)
     {
-        allocateNewBuffer = true;
+        return NULL;
     }
 
+    unsigned int bufferSize = GetBufferSizeForThread(pThreadBufferList->GetCount(), requestSize, availableBufferSize);
+
     EventPipeBuffer *pNewBuffer = NULL;
-    if (allocateNewBuffer)
+    if (pPreallocatedBuffer != NULL && preallocatedBufferSize == bufferSize)
     {
-        // Pick a buffer size by multiplying the base buffer size by the number of buffers already allocated for this thread.
-        unsigned int sizeMultiplier = pThreadBufferList->GetCount() + 1;
-
-        // Pick the base buffer size based.  Debug builds have a smaller size to stress the allocate/steal path more.
-        unsigned int baseBufferSize =
-#ifdef _DEBUG
-            30 * 1024; // 30K
-#else
-            100 * 1024; // 100K
-#endif
-        unsigned int bufferSize = baseBufferSize * sizeMultiplier;
-
-        // Make sure that buffer size >= request size so that the buffer size does not
-        // determine the max event size.
-        _ASSERTE(requestSize <= availableBufferSize);
-        bufferSize = Max(requestSize, bufferSize);
-        bufferSize = Min((unsigned int)bufferSize, (unsigned int)availableBufferSize);
-
-        // Don't allow the buffer size to exceed 1MB.
-        const unsigned int maxBufferSize = 1024 * 1024;
-        bufferSize = Min(bufferSize, maxBufferSize);
-
-        // EX_TRY is used here as opposed to new (nothrow) because
-        // the constructor also allocates a private buffer, which
-        // could throw, and cannot be easily checked
-        EX_TRY
-        {
-            // The sequence counter is exclusively mutated on this thread so this is a thread-local
-            // read.
-            unsigned int sequenceNumber = pSessionState->GetVolatileSequenceNumber();
-            pNewBuffer = new EventPipeBuffer(bufferSize, pSessionState->GetThread(), sequenceNumber);
-        }
-        EX_CATCH
-        {
-            pNewBuffer = NULL;
-        }
-        EX_END_CATCH(SwallowAllExceptions);
-
+        pNewBuffer = pPreallocatedBuffer;
+    }
+    else
+    {
+        pNewBuffer = NewEventPipeBuffer(pSessionState, bufferSize);
         if (pNewBuffer == NULL)
         {
             return NULL;
         }
+    }
 
-        m_sizeOfAllBuffers += bufferSize;
-        if (m_sequencePointAllocationBudget != 0)
+    m_sizeOfAllBuffers += bufferSize;
+    if (m_sequencePointAllocationBudget != 0)
+    {
+        // sequence point bookkeeping
+        if (bufferSize >= m_remainingSequencePointAllocationBudget)
         {
-            // sequence point bookkeeping
-            if (bufferSize >= m_remainingSequencePointAllocationBudget)
-            {
-                EventPipeSequencePoint* pSequencePoint = new (nothrow) EventPipeSequencePoint();
-                if (pSequencePoint != NULL)
-                {
-                    InitSequencePointThreadListHaveLock(pSequencePoint);
-                    EnqueueSequencePoint(pSequencePoint);
-                }
-                m_remainingSequencePointAllocationBudget = m_sequencePointAllocationBudget;
-            }
-            else
+            EventPipeSequencePoint* pSequencePoint = new (nothrow) EventPipeSequencePoint();
+            if (pSequencePoint != NULL)
             {
-                m_remainingSequencePointAllocationBudget -= bufferSize;
+                InitSequencePointThreadListHaveLock(pSequencePoint);
+                EnqueueSequencePoint(pSequencePoint);
             }
+            m_remainingSequencePointAllocationBudget = m_sequencePointAllocationBudget;
+        }
+        else
+        {
+            m_remainingSequencePointAllocationBudget -= bufferSize;
         }
+    }
 #ifdef _DEBUG
-        m_numBuffersAllocated++;
+    m_numBuffersAllocated++;
 #endif // _DEBUG
-    }
 
     // Set the buffer on the thread.
-    if (pNewBuffer != NULL)
-    {
-        pThreadBufferList->InsertTail(pNewBuffer);
-        return pNewBuffer;
-    }
-
-    return NULL;
+    pThreadBufferList->InsertTail(pNewBuffer);
+    return pNewBuffer;
 }
 
 void EventPipeBufferManager::EnqueueSequencePoint(EventPipeSequencePoint* pSequencePoint)
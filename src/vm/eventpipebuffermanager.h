@@ -87,6 +87,13 @@ private:
     // A NULL return value means that a buffer could not be allocated.
     EventPipeBuffer* AllocateBufferForThread(EventPipeThreadSessionState* pSessionState, unsigned int requestSize, BOOL & writeSuspended);
 
+    // Does the bookkeeping part of AllocateBufferForThread once the lock is held. pPreallocatedBuffer, if non-NULL,
+    // is used instead of allocating a new buffer when its size matches the size policy picks.
+    EventPipeBuffer* AllocateBufferForThreadHaveLock(EventPipeThreadSessionState* pSessionState,
+                                                     unsigned int requestSize,
+                                                     EventPipeBuffer* pPreallocatedBuffer,
+                                                     unsigned int preallocatedBufferSize);
+
     // Add a buffer to the thread buffer list.
     void AddBufferToThreadBufferList(EventPipeBufferList *pThreadBuffers, EventPipeBuffer *pBuffer);
 
@@ -476,6 +476,11 @@ public:
     ~ForcedGCHolder() { LIMITED_METHOD_CONTRACT; s_forcedGCInProgress = false; }
 };
 
+// When a heap dump is taken during a background GC (ETW_HeapDumpUseBackgroundGC), the blocking GCs that
+// happen while we wait for it must not dump the heap, and only one of the BGC threads does the walk.
+static bool s_backgroundHeapDumpInProgress = false;
+static LONG s_backgroundHeapDumpPending = FALSE;
+
 BOOL ETW::GCLog::ShouldWalkStaticsAndCOMForEtw()
 {
     LIMITED_METHOD_CONTRACT;
@@ -507,6 +512,31 @@ BOOL ETW::GCLog::ShouldWalkHeapRootsForEtw()
                                      CLR_GCHEAPDUMP_KEYWORD);
 }
 
+BOOL ETW::GCLog::IsBackgroundHeapDumpInProgress()
+{
+    LIMITED_METHOD_CONTRACT;
+    return s_backgroundHeapDumpInProgress;
+}
+
+// Lets the GC know whether the next BGC needs to walk the heap for a background heap dump, without
+// claiming the dump; ShouldDoBackgroundHeapDump does that once the BGC has swept.
+BOOL ETW::GCLog::IsBackgroundHeapDumpPending()
+{
+    LIMITED_METHOD_CONTRACT;
+    return s_backgroundHeapDumpInProgress &&
+        (VolatileLoad(&s_backgroundHeapDumpPending) == TRUE);
+}
+
+// Called by each BGC thread once the BGC has swept, with the EE suspended. Returns TRUE for exactly one
+// of them if a background heap dump was requested and hasn't been done yet.
+BOOL ETW::GCLog::ShouldDoBackgroundHeapDump()
+{
+    LIMITED_METHOD_CONTRACT;
+    return s_backgroundHeapDumpInProgress &&
+        (ShouldWalkHeapObjectsForEtw() || ShouldWalkHeapRootsForEtw()) &&
+        (InterlockedExchange(&s_backgroundHeapDumpPending, FALSE) == TRUE);
+}
+
 BOOL ETW::GCLog::ShouldTrackMovementForEtw()
 {
     LIMITED_METHOD_CONTRACT;
@@ -971,11 +1001,35 @@ HRESULT ETW::GCLog::ForceGCForDiagnostics()
 #endif // FEATURE_REDHAWK
         
         ForcedGCHolder forcedGCHolder;
-        
-        hr = GCHeapUtilities::GetGCHeap()->GarbageCollect(
-            -1,     // all generations should be collected
-            false,  // low_memory_p
-            collection_blocking);
+
+        bool fDumpedInBackground = false;
+        if (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_ETW_HeapDumpUseBackgroundGC) &&
+            GCHeapUtilities::GetGCHeap()->IsConcurrentGCEnabled())
+        {
+            // The BGC walks the heap after it has swept (see GCToEEInterface::DiagWalkBGCSurvivors) so
+            // the EE is only suspended for the walk itself.
+            s_backgroundHeapDumpInProgress = true;
+            InterlockedExchange(&s_backgroundHeapDumpPending, TRUE);
+
+            hr = GCHeapUtilities::GetGCHeap()->GarbageCollect(
+                -1,     // all generations should be collected
+                false,  // low_memory_p
+                collection_non_blocking);
+            GCHeapUtilities::GetGCHeap()->WaitUntilConcurrentGCComplete();
+
+            // If we didn't get a BGC (e.g. the GC decided to do a blocking gen2 instead) fall back to
+            // dumping in a blocking GC.
+            fDumpedInBackground = (InterlockedExchange(&s_backgroundHeapDumpPending, FALSE) == FALSE);
+            s_backgroundHeapDumpInProgress = false;
+        }
+
+        if (!fDumpedInBackground)
+        {
+            hr = GCHeapUtilities::GetGCHeap()->GarbageCollect(
+                -1,     // all generations should be collected
+                false,  // low_memory_p
+                collection_blocking);
+        }
 
 #ifndef FEATURE_REDHAWK
     }
@@ -5320,6 +5374,52 @@ VOID ETW::MethodLog::MethodJitted(MethodDesc *pMethodDesc, SString *namespaceOrC
     } EX_CATCH { } EX_END_CATCH(SwallowAllExceptions);
 }
 
+/*******************************************************/
+/* This is called by the runtime after a method is jitted to report its compile cost */
+/*******************************************************/
+VOID ETW::MethodLog::MethodJitStats(MethodDesc *pMethodDesc, ULONG ulNativeCodeSize, LONGLONG llJitTimeTicks, PrepareCodeConfig *pConfig)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_TRIGGERS;
+        PRECONDITION(pMethodDesc != NULL);
+    } CONTRACTL_END;
+
+    EX_TRY
+    {
+        if(ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, 
+                                        TRACE_LEVEL_VERBOSE, 
+                                        CLR_JIT_KEYWORD))
+        {
+            ULONG ulMethodILSize = 0;
+            if(pMethodDesc->IsIL())
+            {
+                COR_ILMETHOD_DECODER::DecoderStatus decoderstatus = COR_ILMETHOD_DECODER::FORMAT_ERROR;
+                COR_ILMETHOD_DECODER ILHeader(pMethodDesc->GetILHeader(), pMethodDesc->GetMDImport(), &decoderstatus);
+                ulMethodILSize = (ULONG)ILHeader.GetCodeSize();
+            }
+
+            ULONGLONG ullJitTimeMicroseconds = 0;
+            LARGE_INTEGER frequency;
+            if(llJitTimeTicks > 0 && QueryPerformanceFrequency(&frequency) && frequency.QuadPart != 0)
+            {
+                ullJitTimeMicroseconds = (ULONGLONG)(llJitTimeTicks * 1000000 / frequency.QuadPart);
+            }
+
+            ReJITID rejitId = (pConfig != nullptr) ? pConfig->GetCodeVersion().GetILCodeVersionId() : 0;
+            USHORT usJitOptimizationTier = (USHORT)PrepareCodeConfig::GetJitOptimizationTier(pConfig, pMethodDesc);
+
+            FireEtwMethodJitStats((ULONGLONG)pMethodDesc,
+                                  (ULONGLONG)rejitId,
+                                  ulMethodILSize,
+                                  ulNativeCodeSize,
+                                  ullJitTimeMicroseconds,
+                                  usJitOptimizationTier,
+                                  GetClrInstanceId());
+        }
+    } EX_CATCH { } EX_END_CATCH(SwallowAllExceptions);
+}
+
 /*************************************************/
 /* This is called by the runtime when method jitting started */
 /*************************************************/
@@ -7537,23 +7637,6 @@ bool EventPipeHelper::Enabled()
     LIMITED_METHOD_CONTRACT;
     return EventPipe::Enabled();
 }
-
-bool EventPipeHelper::IsEnabled(DOTNET_TRACE_CONTEXT Context, UCHAR Level, ULONGLONG Keyword)
-{
-    CONTRACTL
-    {
-        NOTHROW;
-        GC_NOTRIGGER;
-    }
-    CONTRACTL_END
-
-    if (Level <= Context.EventPipeProvider.Level || Context.EventPipeProvider.Level == 0)
-    {
-        return (Keyword == (ULONGLONG)0) || (Keyword & Context.EventPipeProvider.EnabledKeywordsBitmask) != 0;
-    }
-
-    return false;
-}
 #endif // FEATURE_PERFTRACING
 
 #if defined(FEATURE_PAL)  && defined(FEATURE_PERFTRACING)
@@ -192,6 +192,32 @@ void SetupAndSprinkleBreakpointsForJittedMethod(NativeCodeVersion
                                );
 }
 
+/****************************************************************************/
+/* GCStressMethodPercent picks a stable subset of methods to instrument, so that
+   large test suites can be run under GCStress in slices rather than all at once.
+   The choice depends only on the module, the method token and GCStressMethodSeed.
+   Like other DWORD knobs the percentage is read as hex, and anything from 0x64 up
+   means every method. */
+
+static bool IsMethodSampledForGcCoverage(MethodDesc* pMD)
+{
+    static DWORD s_methodPercent = (DWORD)-1;
+    static DWORD s_methodSeed;
+
+    if (s_methodPercent == (DWORD)-1)
+    {
+        s_methodSeed = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_GCStressMethodSeed);
+        s_methodPercent = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_GCStressMethodPercent);
+    }
+
+    if (s_methodPercent >= 100)
+        return true;
+
+    ULONG hash = HashStringA(pMD->GetModule()->GetSimpleName()) ^ (ULONG)pMD->GetMemberDef();
+    hash = (hash ^ s_methodSeed) * 0x9E3779B1;
+    return ((hash >> 16) % 100) < s_methodPercent;
+}
+
 /****************************************************************************/
 /* called when a method is first jitted when GCStress level 4 or 8 is on */
 
@@ -205,6 +231,11 @@ void SetupGcCoverage(NativeCodeVersion nativeCodeVersion, BYTE* methodStartPtr)
     }
 #endif
 
+    if (!IsMethodSampledForGcCoverage(nativeCodeVersion.GetMethodDesc()))
+    {
+        return;
+    }
+
     // Ideally we would assert here that m_GcCover is NULL.
     //
     // However, we can't do that (at least not yet), because we may
@@ -1399,6 +1430,23 @@ BOOL OnGcCoverageInterrupt(PCONTEXT regs)
         return TRUE;
     }
 
+    // GCStressHitPercent only does a GC on some of the hits. A skipped safe point
+    // gets its original instruction back and is not visited again. The percentage
+    // is read as hex, like GCStressMethodPercent.
+    static DWORD s_hitPercent = (DWORD)-1;
+    if (s_hitPercent == (DWORD)-1)
+        s_hitPercent = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_GCStressHitPercent);
+
+    if (s_hitPercent < 100)
+    {
+        ULONG hash = ((ULONG)instrPtr ^ (ULONG)GCcoverCount) * 0x9E3779B1;
+        if (((hash >> 16) % 100) >= s_hitPercent)
+        {
+            RemoveGcCoverageInterrupt(instrPtr, savedInstrPtr);
+            return TRUE;
+        }
+    }
+
     Thread* pThread = GetThread();
     _ASSERTE(pThread);
 
@@ -652,11 +652,18 @@ void GCProfileWalkHeap()
     BOOL fWalkedHeapForProfiler = FALSE;
 
 #ifdef FEATURE_EVENT_TRACE
-    if (ETW::GCLog::ShouldWalkStaticsAndCOMForEtw())
+    if (ETW::GCLog::ShouldWalkStaticsAndCOMForEtw() && !ETW::GCLog::IsBackgroundHeapDumpInProgress())
         ETW::GCLog::WalkStaticsAndCOMForETW();
 
     BOOL fShouldWalkHeapRootsForEtw = ETW::GCLog::ShouldWalkHeapRootsForEtw();
     BOOL fShouldWalkHeapObjectsForEtw = ETW::GCLog::ShouldWalkHeapObjectsForEtw();
+
+    // The heap dump will be done by the background GC we are waiting for.
+    if (ETW::GCLog::IsBackgroundHeapDumpInProgress())
+    {
+        fShouldWalkHeapRootsForEtw = FALSE;
+        fShouldWalkHeapObjectsForEtw = FALSE;
+    }
 #else // !FEATURE_EVENT_TRACE
     BOOL fShouldWalkHeapRootsForEtw = FALSE;
     BOOL fShouldWalkHeapObjectsForEtw = FALSE;
@@ -803,6 +810,20 @@ void GCToEEInterface::DiagWalkBGCSurvivors(void* gcContext)
         ETW::GCLog::EndMovedReferences(context);
     }
 #endif //GC_PROFILING || FEATURE_EVENT_TRACE
+
+#ifdef FEATURE_EVENT_TRACE
+    // This is called with the EE suspended after the BGC has swept so only live objects are left. Under
+    // Server GC it's called on each BGC thread; only one of them does the heap dump, for all heaps.
+    if (ETW::GCLog::ShouldDoBackgroundHeapDump())
+    {
+        if (ETW::GCLog::ShouldWalkStaticsAndCOMForEtw())
+            ETW::GCLog::WalkStaticsAndCOMForETW();
+
+        GCProfileWalkHeapWorker(FALSE /* fProfilerPinned */,
+                                ETW::GCLog::ShouldWalkHeapRootsForEtw(),
+                                ETW::GCLog::ShouldWalkHeapObjectsForEtw());
+    }
+#endif // FEATURE_EVENT_TRACE
 }
 
 void GCToEEInterface::StompWriteBarrier(WriteBarrierParameters* args)
@@ -1589,3 +1610,14 @@ void GCToEEInterface::UpdateGCEventStatus(int currentPublicLevel, int currentPub
     }
 #endif // __linux__ && FEATURE_EVENT_TRACE
 }
+
+bool GCToEEInterface::DiagBackgroundHeapDumpRequested()
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef FEATURE_EVENT_TRACE
+    return !!ETW::GCLog::IsBackgroundHeapDumpPending();
+#else // !FEATURE_EVENT_TRACE
+    return false;
+#endif // FEATURE_EVENT_TRACE
+}
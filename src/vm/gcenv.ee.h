@@ -83,6 +83,8 @@ public:
     void VerifySyncTableEntry();
 
     void UpdateGCEventStatus(int publicLevel, int publicKeywords, int privateLevel, int privateKeywords);
+
+    bool DiagBackgroundHeapDumpRequested();
 };
 
 } // namespace standalone
@@ -277,6 +277,19 @@ bool GCToOSInterface::CanGetCurrentProcessorNumber()
 #endif
 }
 
+// Check if the OS can honour VirtualReserveFlags::TransparentLargePages
+bool GCToOSInterface::CanUseTransparentLargePages()
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef FEATURE_PAL
+    return !!PAL_HasVirtualAdviseLargePages();
+#else
+    // Windows has no transparent large pages
+    return false;
+#endif
+}
+
 // Flush write buffers of processors that are executing threads of the current process
 void GCToOSInterface::FlushProcessWriteBuffers()
 {
@@ -322,6 +335,8 @@ void* GCToOSInterface::VirtualReserve(size_t size, size_t alignment, uint32_t fl
 {
     LIMITED_METHOD_CONTRACT;
 
+    void* pRetVal;
+
     if (node == NUMA_NODE_UNDEFINED)
     {
         DWORD memFlags = (flags & VirtualReserveFlags::WriteWatch) ? (MEM_RESERVE | MEM_WRITE_WATCH) : MEM_RESERVE;
@@ -332,17 +347,28 @@ void* GCToOSInterface::VirtualReserve(size_t size, size_t alignment, uint32_t fl
         size_t aligned_size = (size + g_SystemInfo.dwAllocationGranularity - 1) & ~static_cast<size_t>(g_SystemInfo.dwAllocationGranularity - 1);
         if (alignment == 0)
         {
-            return ::ClrVirtualAlloc (0, aligned_size, memFlags, PAGE_READWRITE);
+            pRetVal = ::ClrVirtualAlloc (0, aligned_size, memFlags, PAGE_READWRITE);
         }
         else
         {
-            return ::ClrVirtualAllocAligned (0, aligned_size, memFlags, PAGE_READWRITE, alignment);
+            pRetVal = ::ClrVirtualAllocAligned (0, aligned_size, memFlags, PAGE_READWRITE, alignment);
         }
     }
     else
     {
-        return NumaNodeInfo::VirtualAllocExNuma (::GetCurrentProcess (), NULL, size, MEM_RESERVE, PAGE_READWRITE, node);
+        pRetVal = NumaNodeInfo::VirtualAllocExNuma (::GetCurrentProcess (), NULL, size, MEM_RESERVE, PAGE_READWRITE, node);
     }
+
+#ifdef FEATURE_PAL
+    if ((pRetVal != NULL) && (flags & VirtualReserveFlags::TransparentLargePages))
+    {
+        // This is only advice - if transparent huge pages are disabled we just
+        // get normal pages.
+        PAL_VirtualAdviseLargePages(pRetVal, size);
+    }
+#endif // FEATURE_PAL
+
+    return pRetVal;
 }
 
 // Release virtual memory range previously reserved using VirtualReserve
@@ -410,13 +436,24 @@ bool GCToOSInterface::VirtualCommit(void* address, size_t size, uint16_t node)
 // Parameters:
 //  address - starting virtual address
 //  size    - size of the virtual memory range
+//  flags   - the VirtualReserveFlags the range was reserved with
 // Return:
 //  true if it has succeeded, false if it has failed
-bool GCToOSInterface::VirtualDecommit(void* address, size_t size)
+bool GCToOSInterface::VirtualDecommit(void* address, size_t size, uint32_t flags)
 {
     LIMITED_METHOD_CONTRACT;
 
-    return !!::ClrVirtualFree(address, size, MEM_DECOMMIT);
+    bool success = !!::ClrVirtualFree(address, size, MEM_DECOMMIT);
+
+#ifdef FEATURE_PAL
+    // The PAL remaps decommitted pages, which drops the advice given at reserve time.
+    if (success && (flags & VirtualReserveFlags::TransparentLargePages))
+    {
+        PAL_VirtualAdviseLargePages(address, size);
+    }
+#endif // FEATURE_PAL
+
+    return success;
 }
 
 // Reset virtual memory range. Indicates that data in the memory range specified by address and size is no 
@@ -1274,6 +1274,24 @@ static void SetCardBundleByte(BYTE* addr)
 }
 #endif
 
+// Called once we know ref is in the ephemeral range. With workstation GC the
+// ephemeral generations are all in one segment with older generations at lower
+// addresses, so if dst is in the ephemeral range too, ref can only be in a
+// younger generation than dst if it's at a higher address. Skipping the card
+// for the young->old and same generation stores avoids cards that the next
+// ephemeral GC would have to scan for nothing. This doesn't hold for server GC
+// since the ephemeral range covers the ephemeral segments of all heaps.
+static FORCEINLINE bool EphemeralRefNeedsCard(BYTE* dst, BYTE* ref)
+{
+    if ((dst >= g_ephemeral_low) && (dst < g_ephemeral_high) && (ref <= dst) &&
+        !GCHeapUtilities::IsServerHeap())
+    {
+        return false;
+    }
+
+    return true;
+}
+
 #ifdef FEATURE_USE_ASM_GC_WRITE_BARRIERS
 
 // implemented in assembly
@@ -1410,7 +1428,8 @@ extern "C" HCIMPL2_RAW(VOID, JIT_CheckedWriteBarrier, Object **dst, Object *ref)
         CheckedDestInEphem++;
     }
 #endif
-    if((BYTE*) ref >= g_ephemeral_low && (BYTE*) ref < g_ephemeral_high)
+    if((BYTE*) ref >= g_ephemeral_low && (BYTE*) ref < g_ephemeral_high &&
+       EphemeralRefNeedsCard((BYTE*) dst, (BYTE*) ref))
     {
 #ifdef FEATURE_COUNT_GC_WRITE_BARRIERS
         CheckedAfterRefInEphemFilter++;
@@ -1471,7 +1490,8 @@ extern "C" HCIMPL2_RAW(VOID, JIT_WriteBarrier, Object **dst, Object *ref)
         UncheckedDestInEphem++;
     }
 #endif
-    if((BYTE*) ref >= g_ephemeral_low && (BYTE*) ref < g_ephemeral_high)
+    if((BYTE*) ref >= g_ephemeral_low && (BYTE*) ref < g_ephemeral_high &&
+       EphemeralRefNeedsCard((BYTE*) dst, (BYTE*) ref))
     {
 #ifdef FEATURE_COUNT_GC_WRITE_BARRIERS
         UncheckedAfterRefInEphemFilter++;
@@ -1539,7 +1559,8 @@ void ErectWriteBarrier(OBJECTREF *dst, OBJECTREF ref)
     }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
-    if ((BYTE*) OBJECTREFToObject(ref) >= g_ephemeral_low && (BYTE*) OBJECTREFToObject(ref) < g_ephemeral_high)
+    if ((BYTE*) OBJECTREFToObject(ref) >= g_ephemeral_low && (BYTE*) OBJECTREFToObject(ref) < g_ephemeral_high &&
+        EphemeralRefNeedsCard((BYTE*) dst, (BYTE*) OBJECTREFToObject(ref)))
     {
         // VolatileLoadWithoutBarrier() is used here to prevent fetch of g_card_table from being reordered 
         // with g_lowest/highest_address check above. See comment in StompWriteBarrier.
@@ -59,6 +59,30 @@ FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
     }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
+    // Like the write barrier, only references into the ephemeral range need cards. The copied references
+    // were just written and are hot in the cache, so filtering them is cheaper than dirtying cards (and
+    // card bundles) that the next GC would have to scan for nothing. With server GC the ephemeral range
+    // covers the whole address space and this never skips.
+    {
+        BYTE* ephemeralLow = g_ephemeral_low;
+        BYTE* ephemeralHigh = g_ephemeral_high;
+        size_t count = len / sizeof(Object*);
+        size_t i = 0;
+        for (; i < count; i++)
+        {
+            BYTE* ref = (BYTE*)VolatileLoadWithoutBarrier(&start[i]);
+            if (ref >= ephemeralLow && ref < ephemeralHigh)
+            {
+                break;
+            }
+        }
+
+        if (i == count)
+        {
+            return;
+        }
+    }
+
     size_t startAddress = (size_t)start;
     size_t endAddress = startAddress + len;
     size_t startingClump = startAddress >> card_byte_shift;
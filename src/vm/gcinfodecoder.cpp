@@ -784,19 +784,27 @@ bool GcInfoDecoder::EnumerateLiveSlots(
                 m_Reader.Skip(m_SafePointIndex * numSlots);
             }
 
-            for(UINT32 slotIndex = 0; slotIndex < numSlots; slotIndex++)
+            // Read the live states a word at a time so that runs of dead slots don't have to be
+            // decoded bit by bit
+            for(UINT32 slotBase = 0; slotBase < numSlots; slotBase += BITS_PER_SIZE_T)
             {
-                if(m_Reader.ReadOneFast())
+                int numBits = (int) _min(numSlots - slotBase, (UINT32) BITS_PER_SIZE_T);
+                size_t liveStates = m_Reader.Read(numBits);
+
+                for(UINT32 slotIndex = slotBase; liveStates != 0; slotIndex++, liveStates >>= 1)
                 {
-                    ReportSlotToGC(
-                            slotDecoder,
-                            slotIndex,
-                            pRD,
-                            reportScratchSlots,
-                            inputFlags,
-                            pCallBack,
-                            hCallBack
-                            );
+                    if(liveStates & 1)
+                    {
+                        ReportSlotToGC(
+                                slotDecoder,
+                                slotIndex,
+                                pRD,
+                                reportScratchSlots,
+                                inputFlags,
+                                pCallBack,
+                                hCallBack
+                                );
+                    }
                 }
             }
             goto ReportUntracked;
@@ -2535,6 +2535,18 @@ void NotifyGdb::MethodPrepared(MethodDesc* methodDescPtr)
 
 void NotifyGdb::OnMethodPrepared(MethodDesc* methodDescPtr)
 {
+#ifndef FEATURE_GDBJIT_SYMTAB
+    // Without a symbol table, only methods of modules listed in CORECLR_GDBJIT and the
+    // .debug_frame section can produce an image. If neither is requested there is
+    // nothing to emit, so skip the code lookup and module name conversion below.
+    bool bEmitFrame = false;
+#ifdef FEATURE_GDBJIT_FRAME
+    bEmitFrame = g_pConfig->ShouldEmitDebugFrame();
+#endif
+    if (g_wszModuleNames == nullptr && !bEmitFrame)
+        return;
+#endif // !FEATURE_GDBJIT_SYMTAB
+
     PCODE pCode = methodDescPtr->GetNativeCode();
     if (pCode == NULL)
         return;
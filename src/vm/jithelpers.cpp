@@ -3315,6 +3315,65 @@ HCIMPLEND
 //
 //========================================================================
 
+#include <optsmallperfcritical.h>
+
+//*************************************************************
+// Allocation fast path for boxing
+//
+HCIMPL2(Object*, JIT_Box_MP_FastPortable, CORINFO_CLASS_HANDLE type, void* unboxedData)
+{
+    FCALL_CONTRACT;
+
+    do
+    {
+        _ASSERTE(GCHeapUtilities::UseThreadAllocationContexts());
+
+        // See JIT_NewS_MP_FastPortable for why the call is made early
+        Thread *thread = GetThread();
+
+        TypeHandle typeHandle(type);
+        _ASSERTE(!typeHandle.IsTypeDesc());
+        MethodTable *methodTable = typeHandle.AsMethodTable();
+
+        // The slow helper restores the type and validates that it is a value type
+        if (!methodTable->IsRestored_NoLogging())
+        {
+            break;
+        }
+        _ASSERTE(methodTable->IsValueType());
+        _ASSERTE(!methodTable->IsNullable());
+
+        SIZE_T size = methodTable->GetBaseSize();
+        _ASSERTE(size % DATA_ALIGNMENT == 0);
+
+        gc_alloc_context *allocContext = thread->GetAllocContext();
+        BYTE *allocPtr = allocContext->alloc_ptr;
+        _ASSERTE(allocPtr <= allocContext->alloc_limit);
+        if (size > static_cast<SIZE_T>(allocContext->alloc_limit - allocPtr))
+        {
+            break;
+        }
+        allocContext->alloc_ptr = allocPtr + size;
+
+        _ASSERTE(allocPtr != nullptr);
+        Object *object = reinterpret_cast<Object *>(allocPtr);
+        _ASSERTE(object->HasEmptySyncBlockInfo());
+        object->SetMethodTable(methodTable);
+
+        // Nothing can trigger a GC between the allocation and the copy, so unboxedData does not need protecting
+        CopyValueClassUnchecked(object->UnBox(), unboxedData, methodTable);
+
+        return object;
+    } while (false);
+
+    // Tail call to the slow helper
+    ENDFORBIDGC();
+    return HCCALL2(JIT_Box, type, unboxedData);
+}
+HCIMPLEND
+
+#include <optdefault.h>
+
 /*************************************************************/
 HCIMPL2(Object*, JIT_Box, CORINFO_CLASS_HANDLE type, void* unboxedData)
 {
@@ -5242,6 +5301,71 @@ HCIMPL1(void, JIT_LogMethodEnter, CORINFO_METHOD_HANDLE methHnd_)
 
 HCIMPLEND
 
+// Per-thread state for the reservoir sampling done by JIT_ClassProfile. 0 means not seeded yet.
+#ifndef __GNUC__
+static __declspec(thread) UINT32 t_classProfileRandom = 0;
+#else // !__GNUC__
+static thread_local UINT32 t_classProfileRandom = 0;
+#endif // !__GNUC__
+
+/*************************************************************/
+// Records the class of the receiver at a virtual or interface call site of instrumented tier 0 code, for the optimized
+// code of the method to guess for (see TC_BlockCounting)
+HCIMPL2(void, JIT_ClassProfile, Object *obj, ICorJitInfo::ClassProfile *classProfile)
+{
+    FCALL_CONTRACT;
+    FC_GC_POLL_NOT_NEEDED();
+
+    OBJECTREF objRef = ObjectToOBJECTREF(obj);
+    VALIDATEOBJECTREF(objRef);
+
+    // The call itself will throw for a null receiver
+    if (objRef == NULL)
+    {
+        return;
+    }
+
+    // Don't let the optimized code of a method depend on a type that may be unloaded before it
+    MethodTable *pMT = objRef->GetMethodTable();
+    if (pMT->Collectible())
+    {
+        return;
+    }
+
+    // Updates are racy, the profile is only used as a heuristic. The count stops at UINT32_MAX so
+    // that it never wraps back into the fill phase below.
+    const UINT32 count = classProfile->Count;
+    if (count < UINT32_MAX)
+    {
+        classProfile->Count = count + 1;
+    }
+
+    if (count < ICorJitInfo::ClassProfile::SIZE)
+    {
+        classProfile->ClassTable[count] = (CORINFO_CLASS_HANDLE)pMT;
+        return;
+    }
+
+    // Reservoir sampling, the class replaces a random entry with probability SIZE / (count + 1)
+    UINT32 random = t_classProfileRandom;
+    if (random == 0)
+    {
+        // Seed each thread differently so that threads sharing a call site don't replace the same entries
+        random = GetCurrentThreadId() | 1;
+    }
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    t_classProfileRandom = random;
+
+    const UINT32 index = (UINT32)(random % ((UINT64)count + 1));
+    if (index < ICorJitInfo::ClassProfile::SIZE)
+    {
+        classProfile->ClassTable[index] = (CORINFO_CLASS_HANDLE)pMT;
+    }
+}
+HCIMPLEND
+
 
 
 //========================================================================
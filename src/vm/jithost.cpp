@@ -57,9 +57,13 @@ void JitHost::freeStringConfigValue(const WCHAR* value)
 // to be covered by pooling done by the default malloc.
 //
 // - Keep up to some limit worth of memory, with loose affinization of memory blocks to threads.
-// - On finalizer thread, release the extra memory that was not used recently.
+// - On finalizer thread, release the extra memory that was not used recently. Memory that was needed to satisfy
+//   the peak JIT demand since the last flush is kept around, so that bursts of JIT activity do not keep freeing and
+//   reallocating the same blocks.
 //
 
+static const size_t MaxCachedSlabSize = 0x100000; // Do not cache blocks that are more than 1MB
+
 void* JitHost::allocateSlab(size_t size, size_t* pActualSize)
 {
     size = max(size, sizeof(Slab));
@@ -103,22 +107,38 @@ void* JitHost::allocateSlab(size_t size, size_t* pActualSize)
             m_totalCached -= p->size;
             *pActualSize = p->size;
 
+            m_totalInUse += p->size;
+            m_totalInUseHighWatermark = max(m_totalInUseHighWatermark, m_totalInUse);
+
             return p;
         }
     }
 
+    void* slab = ClrAllocInProcessHeap(0, S_SIZE_T(size));
+
+    if (slab != NULL && size < MaxCachedSlabSize)
+    {
+        CrstHolder lock(&m_jitSlabAllocatorCrst);
+
+        m_totalInUse += size;
+        m_totalInUseHighWatermark = max(m_totalInUseHighWatermark, m_totalInUse);
+    }
+
     *pActualSize = size;
-    return ClrAllocInProcessHeap(0, S_SIZE_T(size));
+    return slab;
 }
 
 void JitHost::freeSlab(void* slab, size_t actualSize)
 {
     _ASSERTE(actualSize >= sizeof(Slab));
 
-    if (actualSize < 0x100000) // Do not cache blocks that are more than 1MB
+    if (actualSize < MaxCachedSlabSize)
     {
         CrstHolder lock(&m_jitSlabAllocatorCrst);
 
+        _ASSERTE(m_totalInUse >= actualSize);
+        m_totalInUse -= actualSize;
+
         if (m_totalCached < g_pConfig->JitHostMaxSlabCache()) // Do not cache more than maximum allowed value
         {
             m_totalCached += actualSize;
@@ -156,18 +176,31 @@ void JitHost::reclaim()
             return;
         m_lastFlush = ticks;
 
-        // Flush all slabs in m_pPreviousCachedList
+        // Flush slabs in m_pPreviousCachedList, but keep enough cached memory to satisfy the peak JIT demand
+        // seen since the last flush
         for (;;)
         {
             Slab* slabToDelete = NULL;
 
             {
                 CrstHolder lock(&m_jitSlabAllocatorCrst);
+
+                size_t peakDemand = m_totalInUseHighWatermark - min(m_totalInUseHighWatermark, m_totalInUse);
+
                 slabToDelete = m_pPreviousCachedList;
-                if (slabToDelete == NULL)
+                if (slabToDelete == NULL || m_totalCached - slabToDelete->size < peakDemand)
                 {
-                    m_pPreviousCachedList = m_pCurrentCachedList;
+                    // Whatever is left of the previous list stays there together with the current list, it will be
+                    // considered for flushing again next time around
+                    Slab** ppLast = &m_pPreviousCachedList;
+                    while (*ppLast != NULL)
+                    {
+                        ppLast = &(*ppLast)->pNext;
+                    }
+                    *ppLast = m_pCurrentCachedList;
+
                     m_pCurrentCachedList = NULL;
+                    m_totalInUseHighWatermark = m_totalInUse;
                     break;
                 }
                 m_totalCached -= slabToDelete->size;
@@ -22,6 +22,8 @@ private:
     Slab* m_pCurrentCachedList;
     Slab* m_pPreviousCachedList;
     size_t m_totalCached;
+    size_t m_totalInUse;            // size of cacheable slabs currently handed out to the JIT
+    size_t m_totalInUseHighWatermark; // max of m_totalInUse since the last flush
     DWORD m_lastFlush;
 
     JitHost() {}
@@ -12026,39 +12026,56 @@ HRESULT CEEJitInfo::allocMethodBlockCounts (
 
     JIT_TO_EE_TRANSITION();
 
-#ifdef FEATURE_PREJIT
-
-    // We need to know the code size. Typically we can get the code size
-    // from m_ILHeader. For dynamic methods, m_ILHeader will be NULL, so
-    // for that case we need to use DynamicResolver to get the code size.
-
-    unsigned codeSize = 0; 
-    if (m_pMethodBeingCompiled->IsDynamicMethod())
-    {
-        unsigned stackSize, ehSize;
-        CorInfoOptions options;
-        DynamicResolver * pResolver = m_pMethodBeingCompiled->AsDynamicMethodDesc()->GetResolver();        
-        pResolver->GetCodeInfo(&codeSize, &stackSize, &options, &ehSize);
+#ifdef FEATURE_TIERED_COMPILATION
+    if (m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0) &&
+        TieredCompilationManager::IsEligibleForBlockCounting(m_pMethodBeingCompiled))
+    {
+        // The counts recorded by the instrumented tier 0 code are handed back to the JIT when the method is promoted to tier 1
+        _ASSERTE(m_pMethodBeingCompiled->IsEligibleForTieredCompilation());
+        *pBlockCounts =
+            GetAppDomain()->GetTieredCompilationManager()->AllocateMethodBlockCounts(
+                m_pMethodBeingCompiled,
+                count,
+                m_ILHeader->GetCodeSize());
+        hr = S_OK;
     }
     else
+#endif // FEATURE_TIERED_COMPILATION
     {
-        codeSize = m_ILHeader->GetCodeSize();    
-    }
-    
-    *pBlockCounts = m_pMethodBeingCompiled->GetLoaderModule()->AllocateMethodBlockCounts(m_pMethodBeingCompiled->GetMemberDef(), count, codeSize);
-    hr = (*pBlockCounts != nullptr) ? S_OK : E_OUTOFMEMORY;
+#ifdef FEATURE_PREJIT
+
+        // We need to know the code size. Typically we can get the code size
+        // from m_ILHeader. For dynamic methods, m_ILHeader will be NULL, so
+        // for that case we need to use DynamicResolver to get the code size.
+
+        unsigned codeSize = 0;
+        if (m_pMethodBeingCompiled->IsDynamicMethod())
+        {
+            unsigned stackSize, ehSize;
+            CorInfoOptions options;
+            DynamicResolver * pResolver = m_pMethodBeingCompiled->AsDynamicMethodDesc()->GetResolver();
+            pResolver->GetCodeInfo(&codeSize, &stackSize, &options, &ehSize);
+        }
+        else
+        {
+            codeSize = m_ILHeader->GetCodeSize();
+        }
+
+        *pBlockCounts = m_pMethodBeingCompiled->GetLoaderModule()->AllocateMethodBlockCounts(m_pMethodBeingCompiled->GetMemberDef(), count, codeSize);
+        hr = (*pBlockCounts != nullptr) ? S_OK : E_OUTOFMEMORY;
 #else // FEATURE_PREJIT
-    _ASSERTE(!"allocMethodBlockCounts not implemented on CEEJitInfo!");
-    hr = E_NOTIMPL;
+        _ASSERTE(!"allocMethodBlockCounts not implemented on CEEJitInfo!");
+        hr = E_NOTIMPL;
 #endif // !FEATURE_PREJIT
+    }
 
     EE_TO_JIT_TRANSITION();
     
     return hr;
 }
 
-// Consider implementing getBBProfileData on CEEJitInfo.  This will allow us
-// to use profile info in codegen for non zapped images.
+// Profile info for non zapped images is only available for tier 1 code, from the block counts recorded by the
+// instrumented tier 0 code of the method (see TC_BlockCounting).
 HRESULT CEEJitInfo::getMethodBlockCounts (
     CORINFO_METHOD_HANDLE         ftnHnd,
     UINT32 *                      pCount,          // pointer to the count of <ILOffset, ExecutionCount> tuples
@@ -12066,9 +12083,49 @@ HRESULT CEEJitInfo::getMethodBlockCounts (
     UINT32 *                      pNumRuns
     )
 {
-    LIMITED_METHOD_CONTRACT;
-    _ASSERTE(!"getMethodBlockCounts not implemented on CEEJitInfo!");
-    return E_NOTIMPL;
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    _ASSERTE(pCount != nullptr);
+    _ASSERTE(pBlockCounts != nullptr);
+
+    // Initialize outputs in case we return E_FAIL
+    *pCount = 0;
+    *pBlockCounts = nullptr;
+    if (pNumRuns != nullptr)
+    {
+        *pNumRuns = 0;
+    }
+
+    HRESULT hr = E_FAIL;
+
+#ifdef FEATURE_TIERED_COMPILATION
+    MethodDesc *pMD = GetMethod(ftnHnd);
+    if (m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1) &&
+        pMD == m_pMethodBeingCompiled &&
+        TieredCompilationManager::IsEligibleForBlockCounting(pMD))
+    {
+        UINT32 ilSize;
+        if (GetAppDomain()->GetTieredCompilationManager()->GetMethodBlockCounts(pMD, pCount, pBlockCounts, &ilSize))
+        {
+            // A failed result with non-null block counts tells the JIT that the IL has changed since the counts were
+            // recorded, and that they should be discarded
+            if (ilSize == m_ILHeader->GetCodeSize())
+            {
+                if (pNumRuns != nullptr)
+                {
+                    *pNumRuns = 1;
+                }
+                hr = S_OK;
+            }
+        }
+    }
+#endif // FEATURE_TIERED_COMPILATION
+
+    return hr;
 }
 
 void CEEJitInfo::allocMem (
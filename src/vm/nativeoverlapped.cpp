@@ -90,6 +90,48 @@ FCIMPL3(void, CheckVMForIOPacket, LPOVERLAPPED* lpOverlapped, DWORD* errorCode,
 }
 FCIMPLEND
 
+// Freed native overlapped structures are cached together with their async pinning handle (cleared
+// so it doesn't keep the OverlappedData or the user buffers alive), so that steady state I/O doesn't
+// allocate native memory and create a handle for every operation. Each slot is only ever swapped
+// atomically as a whole, so there is no ABA issue.
+#define NATIVE_OVERLAPPED_CACHE_SIZE 64
+static NATIVEOVERLAPPED_AND_HANDLE* s_nativeOverlappedCache[NATIVE_OVERLAPPED_CACHE_SIZE];
+
+static NATIVEOVERLAPPED_AND_HANDLE* TakeCachedNativeOverlapped()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (int i = 0; i < NATIVE_OVERLAPPED_CACHE_SIZE; i++)
+    {
+        if (VolatileLoadWithoutBarrier(&s_nativeOverlappedCache[i]) != NULL)
+        {
+            NATIVEOVERLAPPED_AND_HANDLE* cached = InterlockedExchangeT(&s_nativeOverlappedCache[i], (NATIVEOVERLAPPED_AND_HANDLE*)NULL);
+            if (cached != NULL)
+            {
+                return cached;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static bool TryCacheNativeOverlapped(NATIVEOVERLAPPED_AND_HANDLE* overlapped)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (int i = 0; i < NATIVE_OVERLAPPED_CACHE_SIZE; i++)
+    {
+        if ((VolatileLoadWithoutBarrier(&s_nativeOverlappedCache[i]) == NULL) &&
+            (InterlockedCompareExchangeT(&s_nativeOverlappedCache[i], overlapped, (NATIVEOVERLAPPED_AND_HANDLE*)NULL) == NULL))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 FCIMPL1(LPOVERLAPPED, AllocateNativeOverlapped, OverlappedDataObject* overlappedUNSAFE)
 {
     FCALL_CONTRACT;
@@ -129,9 +171,18 @@ FCIMPL1(LPOVERLAPPED, AllocateNativeOverlapped, OverlappedDataObject* overlapped
         }
     }
 
-    NewHolder<NATIVEOVERLAPPED_AND_HANDLE> overlappedHolder(new NATIVEOVERLAPPED_AND_HANDLE());
-    overlappedHolder->m_handle = GetAppDomain()->CreateTypedHandle(overlapped, HNDTYPE_ASYNCPINNED);
-    lpOverlapped = &(overlappedHolder.Extract()->m_overlapped);
+    NATIVEOVERLAPPED_AND_HANDLE* cachedOverlapped = TakeCachedNativeOverlapped();
+    if (cachedOverlapped != NULL)
+    {
+        StoreObjectInHandle(cachedOverlapped->m_handle, overlapped);
+        lpOverlapped = &(cachedOverlapped->m_overlapped);
+    }
+    else
+    {
+        NewHolder<NATIVEOVERLAPPED_AND_HANDLE> overlappedHolder(new NATIVEOVERLAPPED_AND_HANDLE());
+        overlappedHolder->m_handle = GetAppDomain()->CreateTypedHandle(overlapped, HNDTYPE_ASYNCPINNED);
+        lpOverlapped = &(overlappedHolder.Extract()->m_overlapped);
+    }
 
     lpOverlapped->Internal = 0;
     lpOverlapped->InternalHigh = 0;
@@ -159,8 +210,13 @@ FCIMPL1(void, FreeNativeOverlapped, LPOVERLAPPED lpOverlapped)
 
     CONSISTENCY_CHECK(g_pOverlappedDataClass && (OverlappedDataObject::GetOverlapped(lpOverlapped)->GetMethodTable() == g_pOverlappedDataClass));
 
-    DestroyAsyncPinningHandle(((NATIVEOVERLAPPED_AND_HANDLE*)lpOverlapped)->m_handle);
-    delete lpOverlapped;
+    NATIVEOVERLAPPED_AND_HANDLE* overlappedAndHandle = (NATIVEOVERLAPPED_AND_HANDLE*)lpOverlapped;
+    StoreObjectInHandle(overlappedAndHandle->m_handle, NULL);
+    if (!TryCacheNativeOverlapped(overlappedAndHandle))
+    {
+        DestroyAsyncPinningHandle(overlappedAndHandle->m_handle);
+        delete overlappedAndHandle;
+    }
 
     HELPER_METHOD_FRAME_END();
 }
@@ -212,12 +212,14 @@ void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, cons
         {
             name.AppendPrintf("[%s]", optimizationTier);
         }
+        // Convert the name once and share it between the map file line and jitdump.
+        const char *szName = name.GetANSI(scratch);
         SString line;
-        line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetANSI(scratch));
+        line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, szName);
 
         // Write the line.
         WriteLine(line);
-        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetANSI(scratch), nullptr, nullptr);
+        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, szName, nullptr, nullptr);
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
@@ -357,12 +359,13 @@ void PerfMap::LogStubs(const char* stubType, const char* stubOwner, PCODE pCode,
         StackScratchBuffer scratch;
         SString name;
         name.Printf("stub<%d> %s<%s>", ++(s_Current->m_StubsMapped), stubType, stubOwner);
+        const char *szName = name.GetANSI(scratch);
         SString line;
-        line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetANSI(scratch));
+        line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, szName);
 
         // Write the line.
         s_Current->WriteLine(line);
-        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetANSI(scratch), nullptr, nullptr);
+        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, szName, nullptr, nullptr);
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
@@ -23,6 +23,7 @@
 #include "compile.h"
 #include "ecall.h"
 #include "virtualcallstub.h"
+#include "opinfo.h"
 
 #ifdef FEATURE_PREJIT
 #include "compile.h"
@@ -847,8 +848,13 @@ PCODE MethodDesc::JitCompileCodeLockedEventWrapper(PrepareCodeConfig* pConfig, J
             &methodSignature);
 #endif
 
+        LARGE_INTEGER jitStartTimestamp, jitEndTimestamp;
+        QueryPerformanceCounter(&jitStartTimestamp);
+
         pCode = JitCompileCodeLocked(pConfig, pEntry, &sizeOfCode, &flags);
 
+        QueryPerformanceCounter(&jitEndTimestamp);
+
         // Interpretted methods skip this notification
 #ifdef FEATURE_INTERPRETER
         if (Interpreter::InterpretationStubToMethodInfo(pCode) == NULL)
@@ -861,6 +867,11 @@ PCODE MethodDesc::JitCompileCodeLockedEventWrapper(PrepareCodeConfig* pConfig, J
                 &methodSignature,
                 pCode,
                 pConfig);
+
+            ETW::MethodLog::MethodJitStats(this,
+                sizeOfCode,
+                jitEndTimestamp.QuadPart - jitStartTimestamp.QuadPart,
+                pConfig);
         }
 
     }
@@ -953,6 +964,57 @@ PCODE MethodDesc::JitCompileCodeLockedEventWrapper(PrepareCodeConfig* pConfig, J
     return pCode;
 }
 
+#ifdef FEATURE_TIERED_COMPILATION
+// Returns true if the IL branches back to the same or an earlier instruction, the same test the JIT uses to decide that a
+// method likely has a loop
+static bool ILHasBackwardBranch(COR_ILMETHOD_DECODER* pilHeader)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    const BYTE *ip = pilHeader->Code;
+    const BYTE *end = ip + pilHeader->GetCodeSize();
+    while (ip < end)
+    {
+        OpInfo opInfo;
+        OpArgsVal args;
+        const BYTE *next = opInfo.fetch(ip, &args);
+        switch (opInfo.getArgsInfo())
+        {
+            case ShortInlineBrTarget:
+                if (next + (INT8)args.i <= ip)
+                {
+                    return true;
+                }
+                break;
+
+            case InlineBrTarget:
+                if (next + args.i <= ip)
+                {
+                    return true;
+                }
+                break;
+
+            case InlineSwitch:
+                for (unsigned i = 0; i < args.switch_.count; i++)
+                {
+                    if (next + (INT32)GET_UNALIGNED_VAL32(&args.switch_.targets[i]) <= ip)
+                    {
+                        return true;
+                    }
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        ip = next;
+    }
+
+    return false;
+}
+#endif // FEATURE_TIERED_COMPILATION
+
 PCODE MethodDesc::JitCompileCodeLocked(PrepareCodeConfig* pConfig, JitListLockEntry* pEntry, ULONG* pSizeOfCode, CORJIT_FLAGS* pFlags)
 {
     STANDARD_VM_CONTRACT;
@@ -1068,6 +1130,14 @@ PCODE MethodDesc::JitCompileCodeLocked(PrepareCodeConfig* pConfig, JitListLockEn
         }
         else
         {
+            if (g_pConfig->TieredCompilation_QuickJitForLoops() && pilHeader != NULL && ILHasBackwardBranch(pilHeader))
+            {
+                // Methods with loops that run at tier 0 may spend a lot of time in slower code per call, promote them sooner
+                MethodDesc *methodDesc = pConfig->GetMethodDesc();
+                methodDesc->GetCallCounter()->ReduceCallCountThreshold(
+                    methodDesc,
+                    g_pConfig->TieredCompilation_CallCountThresholdForLoops());
+            }
             pConfig->SetShouldCountCalls();
         }
     }
@@ -1732,7 +1802,12 @@ extern "C" PCODE STDCALL PreStubWorker(TransitionBlock * pTransitionBlock, Metho
     INSTALL_MANAGED_EXCEPTION_DISPATCHER;
     INSTALL_UNWIND_AND_CONTINUE_HANDLER;
 
+#ifndef FEATURE_PAL
+    // This span brackets every prestub call, not just the ones during startup. On Unix
+    // it would fire two events per call whenever the private startup keyword is on,
+    // so it is only traced on Windows, as before.
     ETWOnStartup (PrestubWorker_V1,PrestubWorkerEnd_V1);
+#endif // !FEATURE_PAL
 
     _ASSERTE(!NingenEnabled() && "You cannot invoke managed code inside the ngen compilation process.");
 
@@ -159,13 +159,20 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     HashDatum Data;
 
     DWORD dwHash = m_StringToEntryHashTable->GetHash(pStringData);
+
+    // The local map is only populated for allocators that can unload. It holds a reference on each of its
+    // entries until the map is destroyed and is safe to read while another thread inserts, so a hit can be
+    // returned without taking the global lock.
+    if (!bAppDomainWontUnload && m_StringToEntryHashTable->GetValue(pStringData, &Data, dwHash))
+    {
+        STRINGREF *pStrObj = ((StringLiteralEntry*)Data)->GetStringObject();
+        _ASSERTE(pStrObj != NULL);
+        return pStrObj;
+    }
+
     // Retrieve the string literal from the global string literal map.
     CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
-    // TODO: We can be more efficient by checking our local hash table now to see if
-    // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
-    // (Rather than waiting until after we look the string up in the global map) 
-    
     StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetStringLiteral(pStringData, dwHash, bAddIfNotFound));
 
     _ASSERTE(pEntry || !bAddIfNotFound);
@@ -2393,6 +2393,7 @@ void AwareLock::Enter()
         {
             // We get here if we successfully acquired the mutex.
             m_HoldingThread = pCurThread;
+            m_HoldingOSThreadId = pCurThread->GetOSThreadId64();
             m_Recursion = 1;
             pCurThread->IncLockCount();
 
@@ -2456,6 +2457,7 @@ BOOL AwareLock::TryEnter(INT32 timeOut)
         {
             // We get here if we successfully acquired the mutex.
             m_HoldingThread = pCurThread;
+            m_HoldingOSThreadId = pCurThread->GetOSThreadId64();
             m_Recursion = 1;
             pCurThread->IncLockCount();
 
@@ -2571,8 +2573,14 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     {
         QueryPerformanceCounter(&startTicks);
 
-        // Fire a contention start event for a managed contention
-        FireEtwContentionStart_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId());
+        // Fire a contention start event for a managed contention. The owner's id is read without synchronization and
+        // may be stale, or 0 if the lock has already been released, but the holding Thread is never dereferenced.
+        FireEtwContentionStart_V2(
+            ETW::ContentionLog::ContentionStructs::ManagedContention,
+            GetClrInstanceId(),
+            this,
+            OBJECTREFToObject(GetOwningObject()),
+            (ULONGLONG)VolatileLoadWithoutBarrier(&m_HoldingOSThreadId));
     }
 
     LogContention();
@@ -2725,6 +2733,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     }
 
     m_HoldingThread = pCurThread;
+    m_HoldingOSThreadId = pCurThread->GetOSThreadId64();
     m_Recursion = 1;
     pCurThread->IncLockCount();
 
@@ -434,6 +434,10 @@ private:
     ULONG           m_Recursion;
     PTR_Thread      m_HoldingThread;
 
+    // OS thread id of m_HoldingThread, captured when the lock is acquired so that contending threads can
+    // report the owner without dereferencing a Thread that may be going away.
+    SIZE_T          m_HoldingOSThreadId;
+
     LONG            m_TransientPrecious;
 
 
@@ -454,6 +458,7 @@ private:
 // PreFAST has trouble with intializing a NULL PTR_Thread.
           m_HoldingThread(NULL),
 #endif // DACCESS_COMPILE          
+          m_HoldingOSThreadId(0),
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
           m_waiterStarvationStartTimeMs(0)
@@ -522,14 +527,7 @@ private:
     bool ShouldStopPreemptingWaiters() const;
 
 private: // friend access is required for this unsafe function
-    void InitializeToLockedWithNoWaiters(ULONG recursionLevel, PTR_Thread holdingThread)
-    {
-        WRAPPER_NO_CONTRACT;
-
-        m_lockState.InitializeToLockedWithNoWaiters();
-        m_Recursion = recursionLevel;
-        m_HoldingThread = holdingThread;
-    }
+    void InitializeToLockedWithNoWaiters(ULONG recursionLevel, PTR_Thread holdingThread);
 
 public:
     static void SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration);
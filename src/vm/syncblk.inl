@@ -428,6 +428,16 @@ FORCEINLINE bool AwareLock::LockState::InterlockedObserveWakeSignal_Try_LockAndU
     return false;
 }
 
+FORCEINLINE void AwareLock::InitializeToLockedWithNoWaiters(ULONG recursionLevel, PTR_Thread holdingThread)
+{
+    WRAPPER_NO_CONTRACT;
+
+    m_lockState.InitializeToLockedWithNoWaiters();
+    m_Recursion = recursionLevel;
+    m_HoldingThread = holdingThread;
+    m_HoldingOSThreadId = holdingThread->GetOSThreadId64();
+}
+
 FORCEINLINE void AwareLock::ResetWaiterStarvationStartTime()
 {
     LIMITED_METHOD_CONTRACT;
@@ -479,6 +489,7 @@ FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
     if (m_lockState.InterlockedTryLock())
     {
         m_HoldingThread = pCurThread;
+        m_HoldingOSThreadId = pCurThread->GetOSThreadId64();
         m_Recursion = 1;
         pCurThread->IncLockCount();
         return true;
@@ -525,6 +536,7 @@ FORCEINLINE AwareLock::EnterHelperResult AwareLock::TryEnterBeforeSpinLoopHelper
 
         // Lock was acquired and the spinner was not registered
         m_HoldingThread = pCurThread;
+        m_HoldingOSThreadId = pCurThread->GetOSThreadId64();
         m_Recursion = 1;
         pCurThread->IncLockCount();
         return EnterHelperResult_Entered;
@@ -557,6 +569,7 @@ FORCEINLINE AwareLock::EnterHelperResult AwareLock::TryEnterInsideSpinLoopHelper
 
     // Lock was acquired and spinner was unregistered
     m_HoldingThread = pCurThread;
+    m_HoldingOSThreadId = pCurThread->GetOSThreadId64();
     m_Recursion = 1;
     pCurThread->IncLockCount();
     return EnterHelperResult_Entered;
@@ -580,6 +593,7 @@ FORCEINLINE bool AwareLock::TryEnterAfterSpinLoopHelper(Thread *pCurThread)
 
     // Spinner was unregistered and the lock was acquired
     m_HoldingThread = pCurThread;
+    m_HoldingOSThreadId = pCurThread->GetOSThreadId64();
     m_Recursion = 1;
     pCurThread->IncLockCount();
     return true;
@@ -693,6 +707,7 @@ FORCEINLINE AwareLock::LeaveHelperAction AwareLock::LeaveHelper(Thread* pCurThre
     {
         m_HoldingThread->DecLockCount();
         m_HoldingThread = NULL;
+        m_HoldingOSThreadId = 0;
 
         // Clear lock bit and determine whether we must signal a waiter to wake
         if (!m_lockState.InterlockedUnlock())
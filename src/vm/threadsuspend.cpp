@@ -59,6 +59,11 @@ extern "C" void             RedirectedHandledJITCaseForGCStress_Stub(void);
 // our chances of snagging it at a safe spot).
 #define PING_JIT_TIMEOUT        10
 
+// The first retry in SuspendRuntime waits only this long; the wait doubles after each
+// timeout up to PING_JIT_TIMEOUT. Most threads that missed the first hijack reach a safe
+// spot within a millisecond, so this avoids paying the full ping for them.
+#define PING_JIT_INITIAL_TIMEOUT 1
+
 // When we find a thread in a spot that's not safe to abort -- how long to wait before
 // we try again.
 #define ABORT_POLL_TIMEOUT      10
@@ -4095,6 +4100,7 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
     // Now we keep retrying until we find that no threads are in cooperative mode.  This should be merged into 
     // the first loop.
     //
+    DWORD pingTimeout = PING_JIT_INITIAL_TIMEOUT;
     while (countThreads)
     {
         _ASSERTE (thread == NULL);
@@ -4178,17 +4184,13 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         // return from the method we hijacked (maybe it calls into some other managed code that
         // executes a long loop, for example).  We we wait with a timeout, and retry hijacking/redirection.
         //
-        // This is unfortunate, because it means that in some cases we wait for PING_JIT_TIMEOUT
-        // milliseconds, causing long GC pause times.
-        //
-        // We should fix this, by calling SwitchToThread/Sleep(0) a few times before waiting on the event.
-        // This will not fix it 100% of the time (we may still have to wait on the event), but 
-        // the event is needed to work around limitations of SwitchToThread/Sleep(0).  
-        //
-        // For now, we simply wait.
+        // This is unfortunate, because it means that in some cases we wait for up to PING_JIT_TIMEOUT
+        // milliseconds, causing long GC pause times. To limit that, the wait starts at
+        // PING_JIT_INITIAL_TIMEOUT and backs off towards PING_JIT_TIMEOUT only while threads keep
+        // failing to rendezvous.
         //
 
-        res = g_pGCSuspendEvent->Wait(PING_JIT_TIMEOUT, FALSE);
+        res = g_pGCSuspendEvent->Wait(pingTimeout, FALSE);
 
 
 #ifdef TIME_SUSPEND
@@ -4204,6 +4206,7 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         if (res == WAIT_TIMEOUT || res == WAIT_IO_COMPLETION)
         {
             STRESS_LOG1(LF_SYNC, LL_INFO1000, "    Timed out waiting for rendezvous event %d threads remaining\n", countThreads);
+            pingTimeout = min(pingTimeout * 2, (DWORD)PING_JIT_TIMEOUT);
 #ifdef _DEBUG
             DWORD dbgEndTimeout = GetTickCount();
 
@@ -6717,6 +6720,10 @@ void HandleGCSuspensionForInterruptedThread(CONTEXT *interruptedContext)
         FrameWithCookie<RedirectedThreadFrame> frame(interruptedContext);
         pThread->SetSavedRedirectContext(NULL);
 
+#ifdef TIME_SUSPEND
+        FastInterlockIncrement((LONG*)&g_SuspendStatistics.cntActivationRedirections);
+#endif
+
         frame.Push(pThread);
 
         pThread->PulseGCMode();
@@ -6764,6 +6771,10 @@ void HandleGCSuspensionForInterruptedThread(CONTEXT *interruptedContext)
         // Hijack the return address to point to the appropriate routine based on the method's return type.
         void *pvHijackAddr = GetHijackAddr(pThread, &codeInfo);
         pThread->HijackThread(pvHijackAddr, &executionState);
+
+#ifdef TIME_SUSPEND
+        FastInterlockIncrement((LONG*)&g_SuspendStatistics.cntActivationHijacks);
+#endif
     }
 }
 
@@ -7008,6 +7019,11 @@ void SuspendStatistics::DisplayAndUpdate()
            cntFailedRedirections - g_LastSuspendStatistics.cntFailedRedirections, cntFailedRedirections,
            cntCollideRetry - g_LastSuspendStatistics.cntCollideRetry, cntCollideRetry);
 
+    fprintf(logFile, "Redirected EIP %d (%d), Activation redirects %d (%d), Activation hijacks %d (%d)\n",
+           cntRedirections - g_LastSuspendStatistics.cntRedirections, cntRedirections,
+           cntActivationRedirections - g_LastSuspendStatistics.cntActivationRedirections, cntActivationRedirections,
+           cntActivationHijacks - g_LastSuspendStatistics.cntActivationHijacks, cntActivationHijacks);
+
     fprintf(logFile, "Suspend: All %d (%d). NonGC: %d (%d). InBGC: %d (%d). NonGCInBGC: %d (%d)\n\n",
             cntSuspends - g_LastSuspendStatistics.cntSuspends, cntSuspends,
             cntNonGCSuspends - g_LastSuspendStatistics.cntNonGCSuspends, cntNonGCSuspends, 
@@ -128,6 +128,11 @@ struct SuspendStatistics
     // so it will throw to a blocking point
     int cntRedirections;
 
+    // on Unix, the number of times a thread interrupted by an activation was at a GC safe point and
+    // was redirected, and the number of times it was in non-interruptible code and was hijacked instead
+    int cntActivationRedirections;
+    int cntActivationHijacks;
+
     ///////////////////////////////////////////////////////////////////////////////////////////////
     // And there are some "failure" cases that should never or almost never occur.
 
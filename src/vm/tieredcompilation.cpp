@@ -37,12 +37,15 @@
 // # Overall workflow
 //
 // Methods initially call into OnMethodCalled() and once the call count exceeds
-// a fixed limit we queue work on to our internal list of methods needing to
-// be recompiled (m_methodsToOptimize). If there is currently no thread
-// servicing our queue asynchronously then we use the runtime threadpool
+// a limit we queue work on to our internal lists of methods needing to
+// be recompiled (m_methodsToOptimize, and m_frequentlyCalledMethodsToOptimize for
+// methods that reached the limit quickly, which are serviced first). The limit is
+// raised while the queue is deep (see GetCallCountThreshold()). If there are fewer
+// threads servicing our queue asynchronously than there are queued methods, and
+// fewer than TC_BackgroundWorkerCount, then we use the runtime threadpool
 // QueueUserWorkItem to recruit one. During the callback for each threadpool work
 // item we handle as many methods as possible in a fixed period of time, then
-// queue another threadpool work item if m_methodsToOptimize hasn't been drained.
+// queue another threadpool work item if the queue hasn't been drained.
 //
 // The background thread enters at StaticOptimizeMethodsCallback(), enters the
 // appdomain, and then begins calling OptimizeMethod on each method in the
@@ -225,7 +228,7 @@ bool TieredCompilationManager::OnMethodCodeVersionCalledSubsequently(MethodDesc*
     return success;
 }
 
-void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc)
+void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc, bool isCalledFrequently)
 {
     STANDARD_VM_CONTRACT;
 
@@ -279,13 +282,20 @@ void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc
         CrstHolder holder(&m_lock);
         if (pMethodListItem != NULL)
         {
-            m_methodsToOptimize.InsertTail(pMethodListItem);
+            if (isCalledFrequently)
+            {
+                m_frequentlyCalledMethodsToOptimize.InsertTail(pMethodListItem);
+            }
+            else
+            {
+                m_methodsToOptimize.InsertTail(pMethodListItem);
+            }
             ++m_countOfMethodsToOptimize;
         }
 
-        LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::AsyncPromoteMethodToTier1 Method=0x%pM (%s::%s), code version id=0x%x queued\n",
+        LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::AsyncPromoteMethodToTier1 Method=0x%pM (%s::%s), code version id=0x%x queued%s\n",
             pMethodDesc, pMethodDesc->m_pszDebugClassName, pMethodDesc->m_pszDebugMethodName,
-            t1NativeCodeVersion.GetVersionId()));
+            t1NativeCodeVersion.GetVersionId(), isCalledFrequently ? " (frequently called)" : ""));
 
         if (!IncrementWorkerThreadCountIfNeeded())
         {
@@ -300,6 +310,29 @@ void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc
     }
 }
 
+DWORD TieredCompilationManager::GetCallCountThreshold() const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The queue depth is read without the lock, it's only a heuristic
+    DWORD threshold = g_pConfig->TieredCompilation_CallCountThreshold();
+    UINT32 scaleShift = VolatileLoadWithoutBarrier(&m_countOfMethodsToOptimize) / CallCountThresholdScaleQueueDepth;
+    if (scaleShift == 0)
+    {
+        return threshold;
+    }
+
+    if (scaleShift > MaxCallCountThresholdScaleShift)
+    {
+        scaleShift = MaxCallCountThresholdScaleShift;
+    }
+    if (threshold > (INT_MAX >> scaleShift)) // CallCounter uses 'int'
+    {
+        return INT_MAX;
+    }
+    return threshold << scaleShift;
+}
+
 void TieredCompilationManager::Shutdown()
 {
     STANDARD_VM_CONTRACT;
@@ -696,6 +729,13 @@ void TieredCompilationManager::OptimizeMethod(NativeCodeVersion nativeCodeVersio
     if (CompileCodeVersion(nativeCodeVersion))
     {
         ActivateCodeVersion(nativeCodeVersion);
+
+        // The tier 1 code has consumed the block counts, stop tracking them. The buffer itself stays in the loader
+        // allocator's heap since tier 0 code that is still running may continue to increment it.
+        if (IsEligibleForBlockCounting(nativeCodeVersion.GetMethodDesc()))
+        {
+            RemoveMethodBlockCounts(nativeCodeVersion.GetMethodDesc());
+        }
     }
 }
 
@@ -812,7 +852,11 @@ NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize()
 {
     STANDARD_VM_CONTRACT;
 
-    SListElem<NativeCodeVersion>* pElem = m_methodsToOptimize.RemoveHead();
+    SListElem<NativeCodeVersion>* pElem = m_frequentlyCalledMethodsToOptimize.RemoveHead();
+    if (pElem == NULL)
+    {
+        pElem = m_methodsToOptimize.RemoveHead();
+    }
     if (pElem != NULL)
     {
         NativeCodeVersion nativeCodeVersion = pElem->GetValue();
@@ -828,13 +872,13 @@ bool TieredCompilationManager::IncrementWorkerThreadCountIfNeeded()
     WRAPPER_NO_CONTRACT;
     // m_lock should be held
 
-    if (0 == m_countOptimizationThreadsRunning &&
+    // Each running thread services the queue until it is drained, so another thread is only needed when there are more queued
+    // methods than running threads
+    if (m_countOptimizationThreadsRunning < g_pConfig->TieredCompilation_BackgroundWorkerCount() &&
+        m_countOptimizationThreadsRunning < m_countOfMethodsToOptimize &&
         !m_isAppDomainShuttingDown &&
-        !m_methodsToOptimize.IsEmpty() &&
         !IsTieringDelayActive())
     {
-        // Our current policy throttles at 1 thread, but in the future we
-        // could experiment with more parallelism.
         m_countOptimizationThreadsRunning++;
         return true;
     }
@@ -882,6 +926,10 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(NativeCodeVersion nativeCodeV
             if (g_pConfig->TieredCompilation_QuickJit())
             {
                 flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+                if (IsEligibleForBlockCounting(methodDesc))
+                {
+                    flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+                }
                 return flags;
             }
         }
@@ -904,10 +952,19 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(NativeCodeVersion nativeCodeV
                 goto OptTierOptimized;
             }
             flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+            if (IsEligibleForBlockCounting(methodDesc))
+            {
+                flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+            }
             break;
 
         case NativeCodeVersion::OptimizationTier1:
             flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER1);
+            if (IsEligibleForBlockCounting(methodDesc))
+            {
+                // Use the block counts recorded by the instrumented tier 0 code, if any
+                flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBOPT);
+            }
             // fall through
 
         case NativeCodeVersion::OptimizationTierOptimized:
@@ -923,4 +980,111 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(NativeCodeVersion nativeCodeV
     return flags;
 }
 
+// Block counts are only recorded for methods whose loader allocator is never unloaded. The buffers are allocated from the
+// loader allocator's heap and tracked by MethodDesc, so for a collectible method both the buffer and the key could be freed and
+// reused after its AssemblyLoadContext unloads.
+//static
+bool TieredCompilationManager::IsEligibleForBlockCounting(MethodDesc *pMethodDesc)
+{
+    WRAPPER_NO_CONTRACT;
+
+    return g_pConfig->TieredCompilation_BlockCounting() && !pMethodDesc->GetLoaderAllocator()->IsCollectible();
+}
+
+// Called by the JIT interface when jitting instrumented tier 0 code for a method. The returned buffer is zero-initialized, the
+// instrumented code increments the counts in it, and it remains valid for the lifetime of the method's loader allocator so that
+// the counts can be fed back to the JIT through GetMethodBlockCounts() when the method is promoted to tier 1.
+ICorJitInfo::BlockCounts *TieredCompilationManager::AllocateMethodBlockCounts(
+    MethodDesc *pMethodDesc,
+    UINT32 count,
+    UINT32 ilSize)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(pMethodDesc != nullptr);
+    _ASSERTE(pMethodDesc->IsEligibleForTieredCompilation());
+    _ASSERTE(IsEligibleForBlockCounting(pMethodDesc));
+
+    ICorJitInfo::BlockCounts *blockCounts =
+        (ICorJitInfo::BlockCounts *)(void *)pMethodDesc->GetLoaderAllocator()->GetHighFrequencyHeap()->AllocMem(
+            S_SIZE_T(count) * S_SIZE_T(sizeof(ICorJitInfo::BlockCounts)));
+
+    CrstHolder holder(&m_lock);
+
+    // The method may be jitted at tier 0 more than once (for instance when a JIT retries the compilation), only the latest
+    // buffer is kept track of
+    MethodBlockCountsEntry *existingEntry =
+        const_cast<MethodBlockCountsEntry *>(m_methodBlockCounts.LookupPtr(pMethodDesc));
+    if (existingEntry != nullptr)
+    {
+        *existingEntry = MethodBlockCountsEntry(pMethodDesc, ilSize, count, blockCounts);
+    }
+    else
+    {
+        m_methodBlockCounts.Add(MethodBlockCountsEntry(pMethodDesc, ilSize, count, blockCounts));
+    }
+    return blockCounts;
+}
+
+bool TieredCompilationManager::GetMethodBlockCounts(
+    MethodDesc *pMethodDesc,
+    UINT32 *pCount,
+    ICorJitInfo::BlockCounts **pBlockCounts,
+    UINT32 *pILSize)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(pMethodDesc != nullptr);
+    _ASSERTE(pCount != nullptr);
+    _ASSERTE(pBlockCounts != nullptr);
+    _ASSERTE(pILSize != nullptr);
+
+    CrstHolder holder(&m_lock);
+
+    const MethodBlockCountsEntry *entry = m_methodBlockCounts.LookupPtr(pMethodDesc);
+    if (entry == nullptr)
+    {
+        return false;
+    }
+
+    // The counts may still be incremented by tier 0 code running concurrently, they are only used as a heuristic
+    *pCount = entry->count;
+    *pBlockCounts = entry->blockCounts;
+    *pILSize = entry->ilSize;
+    return true;
+}
+
+void TieredCompilationManager::RemoveMethodBlockCounts(MethodDesc *pMethodDesc)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(pMethodDesc != nullptr);
+
+    CrstHolder holder(&m_lock);
+
+    // Methods that started out with pregenerated code were not instrumented and have no entry
+    if (m_methodBlockCounts.LookupPtr(pMethodDesc) != nullptr)
+    {
+        m_methodBlockCounts.Remove(pMethodDesc);
+    }
+}
+
 #endif // FEATURE_TIERED_COMPILATION && !DACCESS_COMPILE
@@ -10,6 +10,55 @@
 #ifndef TIERED_COMPILATION_H
 #define TIERED_COMPILATION_H
 
+#ifdef FEATURE_TIERED_COMPILATION
+
+// Block counts recorded by instrumented tier 0 code for a method, see TieredCompilationManager::AllocateMethodBlockCounts()
+struct MethodBlockCountsEntry
+{
+    MethodBlockCountsEntry() : pMethod(PTR_NULL), ilSize(0), count(0), blockCounts(nullptr) {}
+    MethodBlockCountsEntry(PTR_MethodDesc m, UINT32 ilSize, UINT32 count, ICorJitInfo::BlockCounts *blockCounts)
+        : pMethod(m), ilSize(ilSize), count(count), blockCounts(blockCounts) {}
+
+    PTR_MethodDesc pMethod;
+    UINT32 ilSize;
+    UINT32 count;
+    ICorJitInfo::BlockCounts *blockCounts;
+};
+
+class MethodBlockCountsHashTraits : public DefaultSHashTraits<MethodBlockCountsEntry>
+{
+public:
+    typedef typename DefaultSHashTraits<MethodBlockCountsEntry>::element_t element_t;
+    typedef typename DefaultSHashTraits<MethodBlockCountsEntry>::count_t count_t;
+
+    typedef PTR_MethodDesc key_t;
+
+    static key_t GetKey(element_t e)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return e.pMethod;
+    }
+    static BOOL Equals(key_t k1, key_t k2)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return k1 == k2;
+    }
+    static count_t Hash(key_t k)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (count_t)dac_cast<TADDR>(k);
+    }
+
+    static const element_t Null() { LIMITED_METHOD_CONTRACT; return element_t(); }
+    static const element_t Deleted() { LIMITED_METHOD_CONTRACT; return element_t((PTR_MethodDesc)-1, 0, 0, nullptr); }
+    static bool IsNull(const element_t &e) { LIMITED_METHOD_CONTRACT; return e.pMethod == PTR_NULL; }
+    static bool IsDeleted(const element_t &e) { LIMITED_METHOD_CONTRACT; return e.pMethod == (PTR_MethodDesc)-1; }
+};
+
+typedef SHash<MethodBlockCountsHashTraits> MethodBlockCountsHash;
+
+#endif // FEATURE_TIERED_COMPILATION
+
 // TieredCompilationManager determines which methods should be recompiled and
 // how they should be recompiled to best optimize the running code. It then
 // handles logistics of getting new code created and installed.
@@ -36,9 +85,33 @@ public:
 public:
     bool OnMethodCodeVersionCalledFirstTime(MethodDesc* pMethodDesc);
     bool OnMethodCodeVersionCalledSubsequently(MethodDesc* pMethodDesc);
-    void AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc);
+    void AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc, bool isCalledFrequently = false);
+    DWORD GetCallCountThreshold() const;
     void Shutdown();
     static CORJIT_FLAGS GetJitFlags(NativeCodeVersion nativeCodeVersion);
+    static bool IsEligibleForBlockCounting(MethodDesc *pMethodDesc);
+
+public:
+    // A method that reaches the call count threshold within this duration of call counting beginning for it is optimized
+    // ahead of other methods that are waiting to be optimized
+    static const DWORD FrequentlyCalledMethodCountingDurationMs = 100;
+
+private:
+    // While the queue of methods waiting to be optimized is deep, the call count threshold for methods that begin call
+    // counting is doubled for every this many methods in the queue, up to MaxCallCountThresholdScaleShift times
+    static const UINT32 CallCountThresholdScaleQueueDepth = 256;
+    static const UINT32 MaxCallCountThresholdScaleShift = 4;
+
+#ifndef DACCESS_COMPILE
+public:
+    ICorJitInfo::BlockCounts *AllocateMethodBlockCounts(MethodDesc *pMethodDesc, UINT32 count, UINT32 ilSize);
+    bool GetMethodBlockCounts(
+        MethodDesc *pMethodDesc,
+        UINT32 *pCount,
+        ICorJitInfo::BlockCounts **pBlockCounts,
+        UINT32 *pILSize);
+    void RemoveMethodBlockCounts(MethodDesc *pMethodDesc);
+#endif
 
 private:
     bool IsTieringDelayActive();
@@ -64,6 +137,7 @@ private:
 
     Crst m_lock;
     SList<SListElem<NativeCodeVersion>> m_methodsToOptimize;
+    SList<SListElem<NativeCodeVersion>> m_frequentlyCalledMethodsToOptimize;
     UINT32 m_countOfMethodsToOptimize;
     BOOL m_isAppDomainShuttingDown;
     DWORD m_countOptimizationThreadsRunning;
@@ -71,6 +145,7 @@ private:
     SArray<MethodDesc*>* m_methodsPendingCountingForTier1;
     HANDLE m_tieringDelayTimerHandle;
     bool m_tier1CallCountingCandidateMethodRecentlyRecorded;
+    MethodBlockCountsHash m_methodBlockCounts;
 
     CLREvent m_asyncWorkDoneEvent;
 
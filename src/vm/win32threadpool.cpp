@@ -4316,6 +4316,16 @@ DWORD WINAPI ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
             {
                 DangerousNonHostedSpinLockHolder tal(&ThreadAdjustmentLock);
 
+                // If the CPU is mostly idle while work items are waiting, the workers are blocked rather than busy.
+                // In that case scale the injection with how long the queue has gone without a dequeue, so that a
+                // burst of blocking work items does not have to wait one gate thread tick per added thread.
+                int threadsToAdd = 1;
+                if (cpuUtilization < CpuUtilizationLow)
+                {
+                    DWORD starvedTime = GetTickCount() - VolatileLoad(&LastDequeueTime);
+                    threadsToAdd = (int)min(max(starvedTime / GATE_THREAD_DELAY, (DWORD)1), (DWORD)NumberOfProcessors);
+                }
+
                 ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
                 while (counts.NumActive < MaxLimitTotalWorkerThreads && //don't add a thread if we're at the max
                        counts.NumActive >= counts.MaxWorking)            //don't add a thread if we're already in the process of adding threads
@@ -4328,13 +4338,16 @@ DWORD WINAPI ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
                     }
 
                     ThreadCounter::Counts newCounts = counts;
-                    newCounts.MaxWorking = newCounts.NumActive + 1;
+                    newCounts.MaxWorking = min(newCounts.NumActive + threadsToAdd, (int)MaxLimitTotalWorkerThreads);
 
                     ThreadCounter::Counts oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, counts);
                     if (oldCounts == counts)
                     {
                         HillClimbingInstance.ForceChange(newCounts.MaxWorking, Starvation);
-                        MaybeAddWorkingWorker();
+                        for (int i = 0; i < threadsToAdd; i++)
+                        {
+                            MaybeAddWorkingWorker();
+                        }
                         break;
                     }
                     else
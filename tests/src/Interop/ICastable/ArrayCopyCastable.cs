@@ -0,0 +1,81 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+using System;
+using System.Runtime.CompilerServices;
+using TestLibrary;
+
+using Console = Internal.Console;
+
+public interface IMarker
+{
+}
+
+// Decides per instance whether it can be cast to IMarker, so two elements with the same
+// MethodTable can give different answers.
+public class PerInstanceCastable : ICastable
+{
+    private readonly bool _isMarker;
+
+    public PerInstanceCastable(bool isMarker)
+    {
+        _isMarker = isMarker;
+    }
+
+    public bool IsInstanceOfInterface(RuntimeTypeHandle interfaceType, out Exception castError)
+    {
+        castError = null;
+        return _isMarker && interfaceType.Equals(typeof(IMarker).TypeHandle);
+    }
+
+    public RuntimeTypeHandle GetImplType(RuntimeTypeHandle interfaceType)
+    {
+        return typeof(PerInstanceCastableImpl).TypeHandle;
+    }
+}
+
+public class PerInstanceCastableImpl
+{
+}
+
+public class Program
+{
+    private static void TestAllElementsCastable()
+    {
+        object[] src = new object[] { new PerInstanceCastable(true), new PerInstanceCastable(true), new PerInstanceCastable(true) };
+        IMarker[] dest = new IMarker[src.Length];
+
+        Array.Copy(src, dest, src.Length);
+
+        for (int i = 0; i < src.Length; i++)
+        {
+            Assert.AreEqual(src[i], dest[i]);
+        }
+    }
+
+    private static void TestLaterElementNotCastable()
+    {
+        // The first element passes the cast check; the second has the same MethodTable but must
+        // still be checked, and fail.
+        object[] src = new object[] { new PerInstanceCastable(true), new PerInstanceCastable(false), new PerInstanceCastable(true) };
+        IMarker[] dest = new IMarker[src.Length];
+
+        Assert.Throws<InvalidCastException>(() => Array.Copy(src, dest, src.Length));
+    }
+
+    public static int Main(string[] args)
+    {
+        try
+        {
+            TestAllElementsCastable();
+            TestLaterElementNotCastable();
+        }
+        catch (Exception e)
+        {
+            Console.WriteLine($"Test Failure: {e}");
+            return 101;
+        }
+
+        return 100;
+    }
+}
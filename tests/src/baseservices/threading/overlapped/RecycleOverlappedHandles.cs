@@ -0,0 +1,55 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Threading;
+
+// Freed native overlapped structures are cached with their async pinned handle, which is
+// cleared when the entry is parked. Run with the GCHandle events enabled so that clearing and
+// reusing those handles goes through the handle event path.
+public class RecycleOverlappedHandles
+{
+    private const int Iterations = 1000;
+
+    private static unsafe void OnComplete(uint errorCode, uint numBytes, NativeOverlapped* pOverlapped)
+    {
+    }
+
+    public static unsafe int Main()
+    {
+        IOCompletionCallback callback = OnComplete;
+
+        try
+        {
+            var live = new NativeOverlapped*[128];
+            for (int i = 0; i < Iterations; i++)
+            {
+                // Allocate more than the cache holds before freeing so that both the cached and
+                // the destroyed paths are hit.
+                for (int j = 0; j < live.Length; j++)
+                {
+                    live[j] = new Overlapped().UnsafePack(callback, new byte[16]);
+                }
+
+                if (i % 100 == 0)
+                {
+                    GC.Collect();
+                }
+
+                for (int j = 0; j < live.Length; j++)
+                {
+                    Overlapped.Free(live[j]);
+                }
+            }
+        }
+        catch (Exception e)
+        {
+            Console.WriteLine("Test Failed: " + e);
+            return 101;
+        }
+
+        Console.WriteLine("Test Passed");
+        return 100;
+    }
+}